@@ -0,0 +1,145 @@
+#include <Arduino.h>
+#include "assets.h"
+#include "scroll.h"
+#include "display.h"
+#include "esp_partition.h"
+#include "esp_log.h"
+
+// Flash asset bundle
+// Static screens and labels are packed on the host into RLE-compressed RGB565
+// images and flashed to their own data partition. The partition is memory
+// mapped, and images are decoded straight from flash into SPI writes: runs go
+// out as a single repeated colour, literals in small chunks. Nothing is
+// decompressed into RAM. Without the partition (or an image) the callers fall
+// back to drawing the screen from primitives.
+//
+// RLE stream: 16-bit tokens, each followed by pixels
+//   ASSET_RUN_FLAG | (n - 1), colour     n copies of colour
+//   (n - 1), colour * n                  n literal pixels
+// Colours are stored as the panel expects them, already inverted.
+
+extern ScrollST7789 tft;
+
+static const char *asset_names[NUM_ASSETS] = { "game_over", "low_batt", "loading", "press_a" };
+
+static const uint8_t *bundle = NULL;
+static const asset_entry_t *asset_table[NUM_ASSETS] = { NULL };
+static uint16_t chunk_buf[ASSET_CHUNK];
+
+// Decoder position, carried across address windows
+typedef struct {
+    const uint16_t *src;
+    const uint16_t *end;
+    uint32_t left;      // Pixels left in the current token
+    bool run;
+} rle_stream_t;
+
+// Push the next n pixels of the stream into the open address window
+static void rle_emit(rle_stream_t *s, uint32_t n) {
+    while (n > 0) {
+        if (s->left == 0) {
+            if (s->src >= s->end)
+                break;
+            uint16_t token = *s->src++;
+            s->left = (token & ASSET_COUNT_MASK) + 1;
+            s->run = token & ASSET_RUN_FLAG;
+        }
+
+        uint32_t count = min(s->left, n);
+        if (s->run) {
+            tft.writeColor(*s->src, count);
+        } else {
+            // Flash is cached and not DMA-capable, copy literals out in chunks
+            for (uint32_t done = 0; done < count; ) {
+                uint32_t chunk = min(count - done, (uint32_t)ASSET_CHUNK);
+                memcpy(chunk_buf, s->src, chunk * sizeof(uint16_t));
+                tft.writePixels(chunk_buf, chunk);
+                s->src += chunk;
+                done += chunk;
+            }
+        }
+
+        s->left -= count;
+        if (s->run && s->left == 0)
+            s->src++; // Past the run colour
+        n -= count;
+    }
+}
+
+const asset_entry_t *asset_find(asset_id id) {
+    if (id < 0 || id >= NUM_ASSETS)
+        return NULL;
+    return asset_table[id];
+}
+
+// Stream an image to the screen, false if the bundle doesn't have it
+bool asset_draw(asset_id id, int x, int y) {
+    const asset_entry_t *a = asset_find(id);
+    if (a == NULL || x < 0 || y < 0 || x + a->w > SCREEN_WIDTH || y + a->h > SCREEN_HEIGHT)
+        return false;
+
+    rle_stream_t s;
+    s.src = (const uint16_t *)(bundle + a->offset);
+    s.end = s.src + a->length / sizeof(uint16_t);
+    s.left = 0;
+    s.run = false;
+
+    // One window per contiguous stretch of panel memory, one when nothing is scrolled
+    scroll_run_t runs[SCROLL_MAX_RUNS];
+    int n = tft.mapRows(y, a->h, runs);
+
+    tft.startWrite();
+    for (int r = 0; r < n; r++) {
+        tft.setAddrWindow(x, runs[r].mem_y, a->w, runs[r].h);
+        rle_emit(&s, (uint32_t)a->w * runs[r].h);
+    }
+    tft.endWrite();
+    return true;
+}
+
+// --- INIT ---
+// Map the bundle and resolve the images the display code knows about
+void assets_init() {
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+        (esp_partition_subtype_t)ASSET_PARTITION_SUBTYPE, ASSET_PARTITION_LABEL);
+    if (part == NULL) {
+        ESP_LOGW("DISPLAY", "NO ASSET PARTITION, DRAWING SCREENS FROM PRIMITIVES");
+        return;
+    }
+
+    const void *ptr;
+    spi_flash_mmap_handle_t handle;
+    esp_err_t err = esp_partition_mmap(part, 0, part->size, SPI_FLASH_MMAP_DATA, &ptr, &handle);
+    if (err != ESP_OK) {
+        ESP_LOGE("DISPLAY", "ASSET PARTITION MMAP FAILED (%s)", esp_err_to_name(err));
+        return;
+    }
+
+    const asset_header_t *header = (const asset_header_t *)ptr;
+    if (header->magic != ASSET_MAGIC || header->version != ASSET_VERSION || header->size > part->size ||
+        sizeof(asset_header_t) + header->count * sizeof(asset_entry_t) > header->size) {
+        ESP_LOGW("DISPLAY", "ASSET PARTITION EMPTY OR INVALID, DRAWING SCREENS FROM PRIMITIVES");
+        spi_flash_munmap(handle);
+        return;
+    }
+
+    // Mapping stays for the life of the program
+    bundle = (const uint8_t *)ptr;
+    const asset_entry_t *entries = (const asset_entry_t *)(bundle + sizeof(asset_header_t));
+
+    int found = 0;
+    for (int i = 0; i < header->count; i++) {
+        const asset_entry_t *e = &entries[i];
+        if (e->offset % 2 != 0 || e->offset + e->length > header->size)
+            continue;
+
+        for (int id = 0; id < NUM_ASSETS; id++) {
+            if (asset_table[id] == NULL && strncmp(e->name, asset_names[id], ASSET_NAME_LEN) == 0) {
+                asset_table[id] = e;
+                found++;
+            }
+        }
+    }
+
+    ESP_LOGI("DISPLAY", "ASSET BUNDLE MAPPED (%d/%d IMAGES, %u BYTES)", found, NUM_ASSETS, (unsigned)header->size);
+}
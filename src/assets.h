@@ -0,0 +1,46 @@
+#include <Arduino.h>
+
+// Flash asset bundle, built by tools/pack_assets.py
+#define ASSET_PARTITION_LABEL "assets"
+#define ASSET_PARTITION_SUBTYPE 0x40
+#define ASSET_MAGIC 0x31414B42 // "BKA1"
+#define ASSET_VERSION 1
+#define ASSET_NAME_LEN 16
+#define ASSET_RUN_FLAG 0x8000  // RLE token: repeat the next pixel, otherwise copy the next pixels
+#define ASSET_COUNT_MASK 0x7FFF
+#define ASSET_CHUNK 64         // Literal pixels copied out of flash per SPI write
+
+#ifndef ASSETS_H
+#define ASSETS_H
+
+typedef enum {
+    ASSET_GAME_OVER,
+    ASSET_LOW_BATT,
+    ASSET_LOADING,
+    ASSET_PRESS_A,
+    NUM_ASSETS
+} asset_id;
+
+// Bundle layout, little endian, as written by the packer
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;
+    uint32_t size;      // Whole bundle, header included
+    uint32_t reserved;
+} asset_header_t;
+
+typedef struct {
+    char name[ASSET_NAME_LEN];
+    uint16_t w;
+    uint16_t h;
+    uint32_t offset;    // From the start of the bundle, 2-byte aligned
+    uint32_t length;    // Bytes of RLE tokens
+} asset_entry_t;
+
+// Function declarations
+void assets_init();
+const asset_entry_t *asset_find(asset_id id);
+bool asset_draw(asset_id id, int x, int y);
+
+#endif
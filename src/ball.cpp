@@ -2,53 +2,327 @@
 #include "ball.h"
 #include "paddle.h"
 #include "display.h"
+#include "profile.h"
 #include "game.h"
 #include "util.h"
 #include "inputs.h"
+#include "dirty.h"
+#include "grid.h"
+#include "sweep.h"
+#include "sprite.h"
+#include "powerups.h"
+#include "esp_log.h"
 
 ball_t ball = {
     .radius = 3,
-    .x = 30, .y = 100,
-    .dx = 2, .dy = -2,
     .speed = STARTER_SPEED,
     .ball_on_paddle = true,
     .hit_paddle = false,
     .launch_angle = 150,
-    .prev_end_x = -1,
-    .prev_end_y = -1,
     .collided_r = -1, .collided_c = -1
 };
 
+// Balls in play
+// Kept as parallel arrays so the physics pass streams through positions and
+// velocities of every live ball in one loop. Slots are reused, `end` bounds
+// the loops to the highest one in use.
+static ball_pool_t pool;
+
 // Get ball struct
 ball_t *get_ball_info() {
     return &ball;
 }
 
+ball_pool_t *get_ball_pool() {
+    return &pool;
+}
+
+// Random launch angle on the indicator's LAUNCH_ANGLE_STEP grid
+float random_launch_angle() {
+    return LAUNCH_ANGLE_STEP * getRandomInt(MIN_LAUNCH_ANGLE / LAUNCH_ANGLE_STEP, MAX_LAUNCH_ANGLE / LAUNCH_ANGLE_STEP);
+}
+
+// --- POOL ---
+// Put a ball in the first free slot, returns the slot or -1 when the pool is full
+int spawn_ball(phys_t x, phys_t y, phys_t dx, phys_t dy) {
+    for (int i = 0; i < BALL_POOL_SIZE; i++) {
+        if (pool.flags[i] & BALL_LIVE)
+            continue;
+
+        pool.x[i] = x;
+        pool.y[i] = y;
+        pool.dx[i] = dx;
+        pool.dy[i] = dy;
+        pool.radius[i] = ball.radius;
+        pool.flags[i] = BALL_LIVE;
+        pool.count++;
+        pool.end = max(pool.end, i + 1);
+        return i;
+    }
+    return -1;
+}
+
+// Screen box a drawn sprite covers
+static dirty_rect_t sprite_box(const ball_sprite_t *s) {
+    return { s->x - s->radius, s->y - s->radius, 2 * s->radius + 1, 2 * s->radius + 1 };
+}
+
+static bool boxes_overlap(const dirty_rect_t *a, const dirty_rect_t *b) {
+    return a->x < b->x + b->w && b->x < a->x + a->w && a->y < b->y + b->h && b->y < a->y + a->h;
+}
+
+static bool covers_paddle(const dirty_rect_t *box) {
+    paddle_t *p_info = get_paddle_info();
+    dirty_rect_t paddle = { paddle_pixel_x(p_info->paddle_x), p_info->paddle_y, p_info->paddle_width, p_info->paddle_height };
+    return boxes_overlap(box, &paddle);
+}
+
+// Every ball's box this frame, binned into coarse cells so a vacated box finds
+// the balls (and powerups) it overlaps without testing every pair
+#define BALL_CELL_COLS (SCREEN_WIDTH / BALL_CELL)
+#define BALL_CELL_ROWS (SCREEN_HEIGHT / BALL_CELL)
+static uint8_t ball_cells[BALL_CELL_ROWS][BALL_CELL_COLS];
+
+static cell_range_t cells_of(const dirty_rect_t *box) {
+    cell_range_t range;
+    range.c0 = max(box->x / BALL_CELL, 0);
+    range.c1 = min((box->x + box->w - 1) / BALL_CELL, BALL_CELL_COLS - 1);
+    range.r0 = max(box->y / BALL_CELL, 0);
+    range.r1 = min((box->y + box->h - 1) / BALL_CELL, BALL_CELL_ROWS - 1);
+    return range;
+}
+
+static void bin_box(const dirty_rect_t *box) {
+    cell_range_t range = cells_of(box);
+    for (int r = range.r0; r <= range.r1; r++)
+        for (int c = range.c0; c <= range.c1; c++)
+            ball_cells[r][c]++;
+}
+
+static bool in_range(const cell_range_t *range, int r, int c) {
+    return r >= range->r0 && r <= range->r1 && c >= range->c0 && c <= range->c1;
+}
+
+// Whether any other ball is binned in the cells of from, the ball's own box at to aside
+static bool covers_other_ball(const dirty_rect_t *from, const dirty_rect_t *to) {
+    cell_range_t src = cells_of(from);
+    cell_range_t own = cells_of(to);
+    for (int r = src.r0; r <= src.r1; r++) {
+        for (int c = src.c0; c <= src.c1; c++) {
+            if (ball_cells[r][c] > (in_range(&own, r, c) ? 1 : 0))
+                return true;
+        }
+    }
+    return false;
+}
+
+// Sprites put back scenery only, so a ball leaving the paddle or another ball
+// would leave a hole in it, which the other ball's differential draw then skips.
+// A box vacated on top of either goes to the dirty list instead, its repaint
+// composes every sprite back. to is where the ball is drawn next, NULL when it
+// leaves play, then any other ball in play may be under it.
+static void vacate_sprite(int i, const dirty_rect_t *to) {
+    const ball_sprite_t *s = get_ball_sprite(i);
+    if (!s->drawn)
+        return;
+
+    dirty_rect_t from = sprite_box(s);
+    bool covered = covers_paddle(&from);
+    if (!covered)
+        covered = (to != NULL) ? covers_other_ball(&from, to) : pool.count > 1 || get_powerup_state()->num_active > 0;
+    if (covered)
+        dirty_add(from.x, from.y, from.w, from.h);
+}
+
+static void free_ball(int i) {
+    vacate_sprite(i, NULL);
+    erase_ball(i);
+    pool.flags[i] = 0;
+    pool.count--;
+    while (pool.end > 0 && !(pool.flags[pool.end - 1] & BALL_LIVE))
+        pool.end--;
+}
+
+// Resting on the paddle, where a served ball waits
+static void place_on_paddle(int i) {
+    paddle_t *p_info = get_paddle_info();
+
+    pool.x[i] = p_info->paddle_x + p_info->paddle_width/2;
+    pool.y[i] = p_info->paddle_y - p_info->paddle_height - ball.radius-1;
+}
+
+// Velocity for a launch at angle degrees (whole degrees, see the launch grid)
+static void aim_ball(int i, int angle) {
+    pool.dx[i] = ball.speed * phys_cos_deg(angle);
+    pool.dy[i] = -ball.speed * phys_sin_deg(angle);
+}
+
+// Empty the pool down to a single ball waiting on the paddle
+void reset_balls() {
+    for (int i = 0; i < pool.end; i++)
+        if (pool.flags[i] & BALL_LIVE)
+            free_ball(i);
+
+    int serve = spawn_ball(0, 0, 0, 0); // Always BALL_SERVE with the pool empty
+    place_on_paddle(serve);
+    ball.ball_on_paddle = true;
+    pool.stress = false;
+}
+
+// MULTIBALL: every ball in play gains MULTIBALL_SPLIT copies, fanned out around it
+void split_balls() {
+    if (ball.ball_on_paddle)
+        return; // Nothing moving to split yet
+
+    int end = pool.end;
+    for (int i = 0; i < end; i++) {
+        if (!(pool.flags[i] & BALL_LIVE))
+            continue;
+
+        for (int k = 1; k <= MULTIBALL_SPLIT; k++) {
+            int deg = (k % 2 ? 1 : -1) * 30 * ((k + 1) / 2);
+            phys_t c = phys_cos_deg(deg), s = phys_sin_deg(deg);
+            phys_t dx = pool.dx[i] * c - pool.dy[i] * s;
+            phys_t dy = pool.dx[i] * s + pool.dy[i] * c;
+            if (spawn_ball(pool.x[i], pool.y[i], dx, dy) < 0)
+                return;
+        }
+    }
+}
+
+// LARGEBALL powerup, every ball in play grows to the largest sprite
+void grow_balls() {
+    for (int i = 0; i < pool.end; i++)
+        if (pool.flags[i] & BALL_LIVE)
+            pool.radius[i] = SPRITE_MAX_RADIUS;
+}
+
+// Ball the paddle should go after: the lowest one coming down, else the lowest one
+int track_ball() {
+    int best = -1;
+    bool best_falling = false;
+    for (int i = 0; i < pool.end; i++) {
+        if (!(pool.flags[i] & BALL_LIVE))
+            continue;
+
+        bool falling = pool.dy[i] > 0;
+        if (best < 0 || (falling && !best_falling) || (falling == best_falling && pool.y[i] > pool.y[best])) {
+            best = i;
+            best_falling = falling;
+        }
+    }
+    return best;
+}
+
+static dirty_rect_t ball_box(int i) {
+    int r = pool.radius[i];
+    return { phys_to_int(pool.x[i]) - r, phys_to_int(pool.y[i]) - r, 2 * r + 1, 2 * r + 1 };
+}
+
+// Whether a box overlaps any ball, where it is drawn or where it moves this frame
+bool covers_ball(int x, int y, int w, int h) {
+    dirty_rect_t box = { x, y, w, h };
+    for (int i = 0; i < pool.end; i++) {
+        if (!(pool.flags[i] & BALL_LIVE))
+            continue;
+        dirty_rect_t to = ball_box(i);
+        if (boxes_overlap(&box, &to))
+            return true;
+        const ball_sprite_t *s = get_ball_sprite(i);
+        if (s->drawn) {
+            dirty_rect_t from = sprite_box(s);
+            if (boxes_overlap(&box, &from))
+                return true;
+        }
+    }
+    return false;
+}
+
+void draw_balls() {
+    // Bin where every ball and powerup is drawn this frame
+    memset(ball_cells, 0, sizeof(ball_cells));
+    for (int i = 0; i < pool.end; i++) {
+        if (!(pool.flags[i] & BALL_LIVE))
+            continue;
+
+        dirty_rect_t box = ball_box(i);
+        bin_box(&box);
+    }
+    for (int i = 0; i < MAX_POWERUPS; i++) {
+        dirty_rect_t box = { 0, 0, POWERUP_SIZE, POWERUP_SIZE };
+        if (powerup_drawn_box(i, &box.x, &box.y))
+            bin_box(&box);
+    }
+
+    for (int i = 0; i < pool.end; i++) {
+        if (!(pool.flags[i] & BALL_LIVE))
+            continue;
+
+        int x = phys_to_int(pool.x[i]);
+        int y = phys_to_int(pool.y[i]);
+        const ball_sprite_t *s = get_ball_sprite(i);
+        if (s->x != x || s->y != y) {
+            dirty_rect_t to = ball_box(i);
+            vacate_sprite(i, &to);
+        }
+        draw_ball(i, x, y, pool.radius[i]);
+    }
+}
+
+#ifdef BALL_STRESS
+// Send 'b' over serial in DEBUG builds: fill the pool to measure frame time against ball count
+// Lost balls are relaunched from mid screen while it's on, lives are never lost
+void ball_stress_toggle() {
+    pool.stress = !pool.stress;
+
+    if (pool.stress) {
+        while (pool.count < BALL_STRESS_COUNT) {
+            int i = spawn_ball(SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2, 0, 0);
+            if (i < 0)
+                break;
+            aim_ball(i, lroundf(random_launch_angle()));
+        }
+    } else {
+        // Keep the lowest slot, the serve ball if it is still waiting
+        int keep = -1;
+        for (int i = 0; i < pool.end; i++) {
+            if (!(pool.flags[i] & BALL_LIVE))
+                continue;
+            if (keep < 0)
+                keep = i;
+            else
+                free_ball(i);
+        }
+    }
+
+    ESP_LOGI("GAME", "BALL STRESS %s (%d BALLS)", pool.stress ? "ON" : "OFF", pool.count);
+}
+#endif
+
 void launch_ball() {
     game_t *game_info = get_game_info();
 
-    ball.dx = ball.speed * cos(ball.launch_angle * M_PI / 180.0);
-    ball.dy = -ball.speed * sin(ball.launch_angle * M_PI / 180.0);
+    // Launch angles sit on a whole-degree grid
+    aim_ball(BALL_SERVE, lroundf(ball.launch_angle));
     ball.ball_on_paddle = false;
+    clear_launch_angle_indicator();
 
     game_info -> last_interval = millis();
 }
 
 void launch_ball_auto() {
-    paddle_t *p_info = get_paddle_info();
     game_t *game_info = get_game_info();
 
-    ball.x = p_info->paddle_x + p_info->paddle_width/2;
-    ball.y = p_info->paddle_y - p_info->paddle_height - ball.radius-1;
+    place_on_paddle(BALL_SERVE);
     
-    ball.launch_angle = getRandomInt(30, 150);
+    ball.launch_angle = random_launch_angle();
 
     while (ball.launch_angle > 80 && ball.launch_angle < 100) {
-        ball.launch_angle = getRandomInt(30, 150);
+        ball.launch_angle = random_launch_angle();
     }
 
     draw_launch_angle_indicator();
-    draw_ball(ball.x, ball.y, ball.x, ball.y, ball.radius);
+    draw_balls();
     
     for (int i = 0; i < 2500; i++) {
         if (debug_input_check() || get_a_pressed()) {
@@ -67,109 +341,201 @@ void launch_ball_auto() {
 }
 
 void center_ball_on_paddle() {
-    paddle_t *p_info = get_paddle_info();
+    place_on_paddle(BALL_SERVE);
+    draw_balls();
+}
+
+// --- COLLISION ---
+// Contacts the ball can make during a move
+typedef enum {
+    CONTACT_NONE,
+    CONTACT_WALL,
+    CONTACT_BRICK,
+    CONTACT_PADDLE
+} contact_type;
 
-    ball.x = p_info->paddle_x + p_info->paddle_width/2;
-    ball.y = p_info->paddle_y - p_info->paddle_height - ball.radius-1; 
+typedef struct {
+    contact_type type;
+    sweep_hit_t hit;
+    int r, c;   // Brick cell
+} contact_t;
 
-    draw_ball(ball.x, ball.y, ball.x, ball.y, ball.radius); 
+static void keep_earliest(contact_t *best, contact_type type, const sweep_hit_t *hit, int r = -1, int c = -1) {
+    if (hit->t < best->hit.t) {
+        best->type = type;
+        best->hit = *hit;
+        best->r = r;
+        best->c = c;
+    }
 }
 
-void ball_collision() {
-    game_t *g_info = get_game_info();
+// Earliest contact of ball i moving by (mx, my), or CONTACT_NONE
+static contact_t first_contact(int i, phys_t mx, phys_t my) {
     paddle_t *p_info = get_paddle_info();
+    phys_t r = pool.radius[i];
+    phys_t x = pool.x[i], y = pool.y[i];
 
-    float old_x = ball.x, old_y = ball.y;
+    contact_t best;
+    best.type = CONTACT_NONE;
+    best.hit.t = PHYS_MAX;
+    sweep_hit_t hit;
 
-    ball.x += ball.dx;
-    ball.y += ball.dy;
+    // Side walls and the header
+    if (sweep_circle_wall(x, r, mx, 0, 1, &hit)) {
+        hit.nx = 1; hit.ny = 0;
+        keep_earliest(&best, CONTACT_WALL, &hit);
+    }
+    if (sweep_circle_wall(x, r, mx, SCREEN_WIDTH, -1, &hit)) {
+        hit.nx = -1; hit.ny = 0;
+        keep_earliest(&best, CONTACT_WALL, &hit);
+    }
+    if (sweep_circle_wall(y, r, my, HEADER_HEIGHT, 1, &hit)) {
+        hit.nx = 0; hit.ny = 1;
+        keep_earliest(&best, CONTACT_WALL, &hit);
+    }
 
-    if (ball.x - ball.radius <= 0 && ball.dx < 0) ball.dx = -ball.dx;
-    if (ball.x + ball.radius >= SCREEN_WIDTH && ball.dx > 0) ball.dx = -ball.dx;
-    if (ball.y - ball.radius <= 15 && ball.dy < 0) ball.dy = -ball.dy;
-    if (old_y - ball.radius <= 15) g_info->redraw_header = true; // bouncing off top header may cause ball shadow to erase it
-    if (ball.y + ball.radius >= SCREEN_HEIGHT && ball.dy > 0 && !ball.hit_paddle) {
-        if (g_info->lives > 0) {
-            g_info->lives -= 1;
-        } else {
-            end_game_and_restart(!g_info->game_started); 
+    // Bricks under the swept box
+    cell_range_t cells = grid_cells_in(phys_to_int(min(x, x + mx) - r) - 1, phys_to_int(min(y, y + my) - r) - 1,
+                                       phys_to_int(max(x, x + mx) + r) + 1, phys_to_int(max(y, y + my) + r) + 1);
+    brick_board_t *board = get_brick_board();
+    for (int br = cells.r0; br <= cells.r1; br++) {
+        uint8_t live = board_row_live(board, br);
+        for (int bc = cells.c0; bc <= cells.c1; bc++) {
+            if (!(live & (1 << bc)))
+                continue;
+            const brick_rect_t *rect = grid_rect(br, bc);
+            if (sweep_circle_rect(x, y, r, mx, my, rect->left, rect->top, rect->right, rect->bottom, &hit))
+                keep_earliest(&best, CONTACT_BRICK, &hit, br, bc);
         }
-        draw_header();
+    }
+
+    // Paddle, where it stands this tick
+    if (sweep_circle_rect(x, y, r, mx, my, p_info->paddle_x, p_info->paddle_y,
+                          p_info->paddle_x + p_info->paddle_width, p_info->paddle_y + p_info->paddle_height, &hit))
+        keep_earliest(&best, CONTACT_PADDLE, &hit);
 
-        ball.x = p_info->paddle_x + p_info->paddle_width/2;
-        ball.y = p_info->paddle_y - p_info->paddle_height - ball.radius-1;
+    return best;
+}
 
-        ball.ball_on_paddle = true;
+// Mirror the velocity off the contact surface
+static void reflect(int i, const sweep_hit_t *hit) {
+    phys_t d = pool.dx[i] * hit->nx + pool.dy[i] * hit->ny;
+    if (d < 0) {
+        pool.dx[i] -= 2 * d * hit->nx;
+        pool.dy[i] -= 2 * d * hit->ny;
     }
-    int brickOffsetY = g_info->current_level.brickOffsetY;
-    int brickRows = g_info->current_level.brickRows;
-    int brickSpacing = g_info->current_level.brickSpacing;
-    int brickHeight = g_info->current_level.brickHeight;
+}
 
-    
-    for (int r = 0; r < g_info->current_level.brickRows; r++) {
-        for (int c = 0; c < g_info->current_level.brickCols; c++) {
-            if (g_info->current_level.bricks[r][c] > 0) {
-                int bx = g_info->current_level.brickOffsetX + c * (g_info->current_level.brickWidth + g_info->current_level.brickSpacing);
-                int by = g_info->current_level.brickOffsetY + r * (g_info->current_level.brickHeight + g_info->current_level.brickSpacing);
-
-                int ballLeft = ball.x - ball.radius;
-                int ballRight = ball.x + ball.radius;
-                int oldBallLeft = old_x - ball.radius;
-                int oldBallRight = old_x + ball.radius;
-                int ballTop = ball.y - ball.radius;
-                int ballBottom = ball.y + ball.radius;
-                int oldBallTop = old_y - ball.radius;
-                int oldBallBottom = old_y + ball.radius;
-                int brickLeft = bx;
-                int brickRight = bx + g_info->current_level.brickWidth;
-                int brickTop = by;
-                int brickBottom = by + g_info->current_level.brickHeight;
-
-                bool collisionX = (oldBallRight <= brickLeft && ballRight >= brickLeft) || 
-                                (oldBallLeft >= brickRight && ballLeft <= brickRight);
-
-                bool collisionY = (oldBallBottom <= brickTop && ballBottom >= brickTop) || 
-                                (oldBallTop >= brickBottom && ballTop <= brickBottom);
-
-                if ((ballRight > brickLeft && ballLeft < brickRight && 
-                    ballBottom > brickTop && ballTop < brickBottom) ||
-                    (collisionX && ballBottom > brickTop && ballTop < brickBottom) ||
-                    (collisionY && ballRight > brickLeft && ballLeft < brickRight)) {
-                    ball.collided_c = c;
-                    ball.collided_r = r;  
-                    g_info->current_level.bricks[r][c]--;
-                    if (g_info->current_level.bricks[r][c] <= 0) {
-                        g_info->game_finished = check_game_finished();
-                        draw_brick(r, c, true, ~ST77XX_BLACK);
-                        g_info->points += 10;
-                        draw_header();
-                    } else {
-                        g_info->game_finished = false;
-                        draw_brick(r, c);
-                    }
-                
-                    int overlapLeft = ballRight - brickLeft;
-                    int overlapRight = brickRight - ballLeft;
-                    int overlapTop = ballBottom - brickTop;
-                    int overlapBottom = brickBottom - ballTop;
-                    int minOverlap = min(min(overlapLeft, overlapRight), min(overlapTop, overlapBottom));
-
-                    if (overlapLeft < overlapRight && overlapLeft < overlapTop && overlapLeft < overlapBottom) {
-                        if (ball.dx > 0) ball.dx = -ball.dx; // Ball was moving right
-                    } else if (overlapRight < overlapLeft && overlapRight < overlapTop && overlapRight < overlapBottom) {
-                        if (ball.dx < 0) ball.dx = -ball.dx; // Ball was moving left
-                    } else if (overlapTop < overlapBottom) {
-                        if (ball.dy > 0) ball.dy = -ball.dy; // Ball was moving down
-                    } else {
-                        if (ball.dy < 0) ball.dy = -ball.dy; // Ball was moving up
-                    }
-                } 
-                else if (oldBallRight > brickLeft && oldBallLeft < brickRight && oldBallBottom > brickTop && oldBallTop < brickBottom) {
-                    ball.collided_c = c;
-                    ball.collided_r = r;   
-                }
+static void hit_brick(int r, int c) {
+    game_t *g_info = get_game_info();
+    const brick_rect_t *rect = grid_rect(r, c);
+
+    ball.collided_c = c;
+    ball.collided_r = r;
+    if (board_hit(r, c) == 0) {
+        g_info->game_finished = check_game_finished();
+        g_info->points += 10;
+        drop_powerup((rect->left + rect->right) / 2, (rect->top + rect->bottom) / 2);
+    } else {
+        g_info->game_finished = false;
+    }
+    // Repainted after the ball moves, fixing anything restored from a stale save-under
+    dirty_add(rect->left, rect->top, rect->right - rect->left, rect->bottom - rect->top);
+}
+
+static void resolve_contact(int i, const contact_t *contact) {
+    switch (contact->type) {
+        case CONTACT_BRICK:
+            hit_brick(contact->r, contact->c);
+            reflect(i, &contact->hit);
+            break;
+        case CONTACT_PADDLE:
+            // The top face aims the ball, the ends just deflect it
+            if (contact->hit.ny < 0 && phys_abs(contact->hit.nx) < phys_abs(contact->hit.ny))
+                paddle_bounce(i);
+            else
+                reflect(i, &contact->hit);
+            pool.flags[i] |= BALL_HIT_PADDLE;
+            ball.hit_paddle = true;
+            break;
+        default:
+            reflect(i, &contact->hit);
+            break;
+    }
+}
+
+// Move ball i for one tick, resolving every contact on the way in time order
+// Long moves are split so no substep covers more than SWEEP_MAX_STEP px
+static void move_ball(int i, phys_t scale) {
+    phys_t dist = phys_sqrt(pool.dx[i] * pool.dx[i] + pool.dy[i] * pool.dy[i]) * scale;
+    int steps = max(1, phys_ceil(dist / phys_t(SWEEP_MAX_STEP)));
+
+    for (int s = 0; s < steps; s++) {
+        phys_t left = 1; // Fraction of this substep still to travel
+        for (int hits = 0; hits < SWEEP_MAX_HITS && left > 0; hits++) {
+            // Velocity may have changed at the last contact
+            phys_t mx = pool.dx[i] * scale / steps * left;
+            phys_t my = pool.dy[i] * scale / steps * left;
+
+            contact_t contact = first_contact(i, mx, my);
+            if (contact.type == CONTACT_NONE) {
+                pool.x[i] += mx;
+                pool.y[i] += my;
+                break;
             }
+
+            pool.x[i] += mx * contact.hit.t;
+            pool.y[i] += my * contact.hit.t;
+            resolve_contact(i, &contact);
+            left *= 1 - contact.hit.t;
         }
     }
-}
\ No newline at end of file
+}
+
+// Ball i left the bottom of the screen, true if that cost a life and the serve was reset
+static bool lose_ball(int i) {
+    game_t *g_info = get_game_info();
+
+    if (pool.stress) {
+        pool.x[i] = SCREEN_WIDTH / 2;
+        pool.y[i] = SCREEN_HEIGHT / 2;
+        aim_ball(i, lroundf(random_launch_angle()));
+        return false;
+    }
+
+    free_ball(i);
+    if (pool.count > 0)
+        return false; // Others still in play
+
+    // That was the last one
+    if (g_info->lives > 0) {
+        g_info->lives -= 1;
+    } else {
+        end_game_and_restart(!g_info->game_started); 
+    }
+
+    reset_balls();
+    return true;
+}
+
+// One physics tick for every ball in play, all sharing the brick broadphase
+void ball_collision() {
+    ball.hit_paddle = false;
+
+    // dx/dy are px per tick at BASE_TICK_RATE
+    phys_t scale = get_tick_scale();
+
+    for (int i = 0; i < pool.end; i++) {
+        if (!(pool.flags[i] & BALL_LIVE))
+            continue;
+        pool.flags[i] &= ~BALL_HIT_PADDLE;
+        move_ball(i, scale);
+    }
+
+    for (int i = 0; i < pool.end; i++) {
+        if (!(pool.flags[i] & BALL_LIVE) || (pool.flags[i] & BALL_HIT_PADDLE))
+            continue;
+        if (pool.y[i] + pool.radius[i] >= SCREEN_HEIGHT && pool.dy[i] > 0 && lose_ball(i))
+            return;
+    }
+}
@@ -1,26 +1,73 @@
 #define MAX_SPEED 7.0
 #define STARTER_SPEED 3.5
+#define MIN_LAUNCH_ANGLE 30
+#define MAX_LAUNCH_ANGLE 150
+#define LAUNCH_ANGLE_STEP 5
+#define SWEEP_MAX_STEP 2.0 // Longest ball move (px) checked in one sweep
+#define SWEEP_MAX_HITS 4   // Contacts resolved per substep, the rest of the move is dropped
+
+// Uncomment to build the 'b' ball stress mode into DEBUG builds
+// Its pool takes ~21 KB of sprite save-unders against ~3 KB for gameplay
+// #define BALL_STRESS
+
+// Ball pool
+#ifdef BALL_STRESS
+#define BALL_POOL_SIZE 64    // Slots, sprites are allocated for every one
+#define BALL_STRESS_COUNT 64 // Balls kept in play by the stress mode
+#else
+#define BALL_POOL_SIZE 9     // One ball split by MULTIBALL twice
+#endif
+#define MULTIBALL_SPLIT 2    // Balls added by the MULTIBALL powerup
+#define BALL_SERVE 0         // Slot of the ball waiting on the paddle
+#define BALL_CELL 8          // Cell size (px) of the map that finds balls drawn over each other
+
+// Ball flags
+#define BALL_LIVE 0x01
+#define BALL_HIT_PADDLE 0x02 // Touched the paddle this tick, can't be lost this tick
 
 
 #ifndef BALL_H
+#define BALL_H
+#include "fixed.h"
+
 // Structs
+// State shared by every ball in play
 typedef struct {
     const int radius;
-    float x, y;
-    float dx, dy;
-    float speed;
+    phys_t speed;
     bool ball_on_paddle;
     bool hit_paddle;
     float launch_angle;
-    int prev_end_x;
-    int prev_end_y;
     int collided_r, collided_c;
 } ball_t;
 
+// Balls in play, one index per ball across all arrays
+typedef struct {
+    phys_t x[BALL_POOL_SIZE], y[BALL_POOL_SIZE];
+    phys_t dx[BALL_POOL_SIZE], dy[BALL_POOL_SIZE];
+    uint8_t radius[BALL_POOL_SIZE];
+    uint8_t flags[BALL_POOL_SIZE];
+    int count;  // Live balls
+    int end;    // One past the highest live slot
+    bool stress;
+} ball_pool_t;
+
 ball_t *get_ball_info();
+ball_pool_t *get_ball_pool();
 void ball_collision();
 void launch_ball();
 void launch_ball_auto();
+float random_launch_angle();
 void center_ball_on_paddle();
+void reset_balls();
+int spawn_ball(phys_t x, phys_t y, phys_t dx, phys_t dy);
+void split_balls();
+void grow_balls();
+int track_ball();
+bool covers_ball(int x, int y, int w, int h);
+void draw_balls();
+#ifdef BALL_STRESS
+void ball_stress_toggle();
+#endif
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,88 @@
+#include <Arduino.h>
+#include "beam.h"
+#include "scroll.h"
+#include "display.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+
+// Beam racing
+// The panel refreshes top to bottom from its own memory. A band written while
+// the refresh is passing through it shows half old, half new: a tear. Without
+// the TE pin, GSCAN tells where the refresh is; a band is held back while the
+// scanline is inside it or will reach it before the write completes, so
+// every write lands entirely behind the refresh pointer. Display lines follow
+// screen rows even while the playfield is hardware scrolled.
+
+extern ScrollST7789 tft;
+
+beam_state_t beam = {
+    .refresh_hz = BEAM_DEFAULT_REFRESH,
+    .line_us = 1000000 / (BEAM_DEFAULT_REFRESH * BEAM_TOTAL_LINES),
+    .frame_wait_us = 0,
+    .last_wait_us = 0,
+    .max_wait_us = 0,
+    .total_wait_us = 0,
+    .frames = 0,
+    .reads = 0,
+    .bad_reads = 0
+};
+
+beam_state_t *get_beam_info() {
+    return &beam;
+}
+
+// Panel refresh rate changed (FRCTRL2)
+void beam_set_refresh(uint32_t refresh_hz) {
+    beam.refresh_hz = refresh_hz;
+    beam.line_us = max(1u, (unsigned)(1000000 / (refresh_hz * BEAM_TOTAL_LINES)));
+}
+
+#if defined(USE_BEAM_RACING) && !defined(DISPLAY_BACKEND_TFT_ESPI)
+// Line the panel is refreshing, -1 if the reply makes no sense
+static int read_scanline() {
+    tft.setSPISpeed(SPI_READ_SPEED);
+    int line = tft.readScanline();
+    tft.setSPISpeed(get_spi_speed());
+
+    beam.reads++;
+    if (line < 0 || line >= BEAM_TOTAL_LINES) {
+        beam.bad_reads++;
+        return -1;
+    }
+    return line;
+}
+
+// Hold a write to rows [y0, y1) until the refresh is clear of them
+void beam_wait(int y0, int y1, uint32_t pixels) {
+    int64_t start = esp_timer_get_time();
+
+    // Lines the refresh advances while this write is on the bus
+    uint32_t write_us = (uint64_t)pixels * 16 * 1000000 / get_spi_speed();
+    int lead = write_us / beam.line_us + BEAM_MARGIN_LINES;
+    int64_t deadline = start + 1000000 / beam.refresh_hz;
+
+    while (esp_timer_get_time() < deadline) {
+        int line = read_scanline();
+        if (line < 0 || line >= y1 || line < y0 - lead)
+            break;
+        // Sleep until the refresh has left the band, then check again
+        delayMicroseconds((y1 - line) * beam.line_us);
+    }
+
+    beam.frame_wait_us += esp_timer_get_time() - start;
+}
+#else
+void beam_wait(int y0, int y1, uint32_t pixels) {}
+#endif
+
+// Called at each frame fence, reports what racing the beam cost this frame
+void beam_end_frame() {
+    beam.last_wait_us = beam.frame_wait_us;
+    beam.max_wait_us = max(beam.max_wait_us, beam.frame_wait_us);
+    beam.total_wait_us += beam.frame_wait_us;
+    beam.frames++;
+    beam.frame_wait_us = 0;
+
+    ESP_LOGV("BEAM", "FRAME WAIT %u us (avg %u us, max %u us)", (unsigned)beam.last_wait_us,
+        (unsigned)(beam.total_wait_us / beam.frames), (unsigned)beam.max_wait_us);
+}
@@ -0,0 +1,33 @@
+#include <Arduino.h>
+
+// ST7789 scanline query
+#define ST7789_GSCAN 0x45
+
+// Beam racing constants
+#define BEAM_TOTAL_LINES 344        // 320 visible + default porches (PORCTRL 0x0C/0x0C)
+#define BEAM_DEFAULT_REFRESH 60     // FRCTRL2 0x0F
+#define BEAM_MARGIN_LINES 2         // Slack for the scanline read itself
+#define BEAM_BAND_ROWS 32           // Fill batches are cut into bands this tall
+
+#ifndef BEAM_H
+#define BEAM_H
+
+typedef struct {
+    uint32_t refresh_hz;
+    uint32_t line_us;           // Time the panel spends on one line
+    uint32_t frame_wait_us;     // Waited so far in the current frame
+    uint32_t last_wait_us;      // Waited in the last finished frame
+    uint32_t max_wait_us;
+    uint64_t total_wait_us;
+    uint32_t frames;
+    uint32_t reads;
+    uint32_t bad_reads;         // Replies outside the frame, beam racing gives up on them
+} beam_state_t;
+
+// Function declarations
+beam_state_t *get_beam_info();
+void beam_set_refresh(uint32_t refresh_hz);
+void beam_wait(int y0, int y1, uint32_t pixels);
+void beam_end_frame();
+
+#endif
@@ -0,0 +1,105 @@
+#include <Arduino.h>
+#include "dirty.h"
+#include "display.h"
+#include "esp_log.h"
+
+// Dirty region tracker
+// Collects rectangles invalidated during a frame (ball erase, brick hits, paddle
+// and powerup movement, header changes) and repaints only the static scenery
+// underneath them once per frame, instead of redrawing the whole brick field.
+
+dirty_state_t dirty = {
+    .rects = {},
+    .num_rects = 0,
+    .frame_pixels = 0,
+    .total_pixels = 0,
+    .frames = 0
+};
+
+dirty_state_t *get_dirty_info() {
+    return &dirty;
+}
+
+// True if the rects overlap or share an edge
+static bool rects_touch(const dirty_rect_t *a, const dirty_rect_t *b) {
+    return a->x <= b->x + b->w && b->x <= a->x + a->w &&
+           a->y <= b->y + b->h && b->y <= a->y + a->h;
+}
+
+static dirty_rect_t rect_union(const dirty_rect_t *a, const dirty_rect_t *b) {
+    int x0 = min(a->x, b->x);
+    int y0 = min(a->y, b->y);
+    int x1 = max(a->x + a->w, b->x + b->w);
+    int y1 = max(a->y + a->h, b->y + b->h);
+    return { x0, y0, x1 - x0, y1 - y0 };
+}
+
+void dirty_add(int x, int y, int w, int h) {
+    // Clip to screen
+    int x0 = max(x, 0);
+    int y0 = max(y, 0);
+    int x1 = min(x + w, SCREEN_WIDTH);
+    int y1 = min(y + h, SCREEN_HEIGHT);
+    if (x1 <= x0 || y1 <= y0)
+        return;
+
+    dirty_rect_t r = { x0, y0, x1 - x0, y1 - y0 };
+
+    // Coalesce with any touching region, repeat until r is disjoint from the rest
+    bool merged = true;
+    while (merged) {
+        merged = false;
+        for (int i = 0; i < dirty.num_rects; i++) {
+            if (rects_touch(&r, &dirty.rects[i])) {
+                r = rect_union(&r, &dirty.rects[i]);
+                dirty.rects[i] = dirty.rects[--dirty.num_rects];
+                merged = true;
+                break;
+            }
+        }
+    }
+
+    if (dirty.num_rects < MAX_DIRTY_RECTS) {
+        dirty.rects[dirty.num_rects++] = r;
+        return;
+    }
+
+    // List full, merge into the region that grows the least
+    int best = 0;
+    long best_growth = -1;
+    for (int i = 0; i < dirty.num_rects; i++) {
+        dirty_rect_t u = rect_union(&r, &dirty.rects[i]);
+        long growth = (long)u.w * u.h - (long)dirty.rects[i].w * dirty.rects[i].h;
+        if (best_growth < 0 || growth < best_growth) {
+            best_growth = growth;
+            best = i;
+        }
+    }
+    dirty.rects[best] = rect_union(&r, &dirty.rects[best]);
+}
+
+void dirty_clear() {
+    dirty.num_rects = 0;
+}
+
+// Repaint everything intersecting the collected regions, returns pixels pushed
+uint32_t dirty_flush() {
+    uint32_t pixels = 0;
+
+    // Repaints are queued, they compose from this frame's snapshot
+    uint8_t scene_slot = (dirty.num_rects > 0) ? capture_scene() : 0;
+    for (int i = 0; i < dirty.num_rects; i++) {
+        dirty_rect_t *r = &dirty.rects[i];
+        pixels += draw_dirty_region(r->x, r->y, r->w, r->h, scene_slot);
+    }
+
+    dirty.frame_pixels = pixels;
+    dirty.total_pixels += pixels;
+    dirty.frames++;
+
+    if (dirty.num_rects > 0)
+        ESP_LOGD("DIRTY", "%d regions, %u px pushed (avg %u px/frame)", dirty.num_rects, (unsigned)pixels, (unsigned)(dirty.total_pixels / dirty.frames));
+
+    dirty.num_rects = 0;
+    return pixels;
+}
@@ -0,0 +1,28 @@
+// Dirty region constants
+#define MAX_DIRTY_RECTS 16
+
+#ifndef DIRTY_H
+#define DIRTY_H
+
+#include <stdint.h>
+
+// Structs
+typedef struct {
+    int x, y, w, h;
+} dirty_rect_t;
+
+typedef struct {
+    dirty_rect_t rects[MAX_DIRTY_RECTS];
+    int num_rects;
+    uint32_t frame_pixels;   // Pixels pushed by the most recent flush
+    uint32_t total_pixels;   // Pixels pushed by all flushes since boot
+    uint32_t frames;         // Number of flushes since boot
+} dirty_state_t;
+
+// Function declarations
+dirty_state_t *get_dirty_info();
+void dirty_add(int x, int y, int w, int h);
+void dirty_clear();
+uint32_t dirty_flush();
+
+#endif
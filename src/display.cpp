@@ -10,21 +10,51 @@
 #include "debug.h"
 #include "esp_log.h"
 #include "system.h"
+#include "dirty.h"
+#include "strip.h"
+#include "framebuffer.h"
+#include "sprite.h"
+#include "hud.h"
+#include "scroll.h"
+#include "render.h"
+#include "font.h"
+#include "powerups.h"
+#include "profile.h"
+#include "assets.h"
+#include "grid.h"
 
 
 
 // Globals
-Adafruit_ST7789 tft = Adafruit_ST7789(TFT_CS, TFT_DC, TFT_RST);
-GFXcanvas1 canvas(SCREEN_WIDTH, SCREEN_HEIGHT);
+ScrollST7789 tft = ScrollST7789(TFT_CS, TFT_DC, TFT_RST);
 ili_9341_t dbginfo;
+static uint32_t spi_speed = SPI_SPEED;
 
 // --- DEBUG ---
 uint8_t get_display_status() {
     // Query display status
+    render_sync();
+#ifndef DISPLAY_BACKEND_TFT_ESPI
+    // Register reads don't hold up at the tuned write clock
+    tft.setSPISpeed(SPI_READ_SPEED);
+#endif
     uint8_t status = tft.readcommand8(0x09);
+#ifndef DISPLAY_BACKEND_TFT_ESPI
+    tft.setSPISpeed(spi_speed);
+#endif
     return status;
 }
 
+uint32_t get_spi_speed() {
+    return spi_speed;
+}
+
+// Panel refresh rate, FRCTRL2 RTNA (0x0F = 60Hz, 0x09 = 75Hz, 0x1F = 39Hz)
+void set_panel_refresh(uint8_t frctrl2) {
+    render_sync();
+    tft.sendCommand(ST7789_FRCTRL2, &frctrl2, 1);
+}
+
 void set_dbg_line (int l) {
     dbginfo.dbg_line = l;
 }
@@ -114,7 +144,12 @@ void display_panic_message(const XtExcFrame *exc_frame) {
 }
 
 // --- BATTERY ---
+static bool draw_screen_asset(asset_id id);
+
 void draw_lowbatt_symbol() {
+    if (draw_screen_asset(ASSET_LOW_BATT))
+        return;
+
     black_screen();
     
     // Battery outline dimensions
@@ -144,288 +179,549 @@ void draw_lowbatt_symbol() {
 
 
 // --- PADDLE ---
+// Column the paddle was last drawn at, -1 once the screen under it was cleared
+static int paddle_drawn_x = -1;
+
+// Scenery along the whole row band the paddle travels in, captured on full redraws
+static uint16_t paddle_under_pixels[SCREEN_WIDTH * PADDLE_MAX_HEIGHT];
+static save_under_t paddle_under = { 0, 0, 0, 0, false, paddle_under_pixels, SCREEN_WIDTH * PADDLE_MAX_HEIGHT };
+
+// Pixel column for a sub-pixel paddle position
+// Rounding keeps the fractional part accumulating in paddle_x, so a speed of
+// e.g. 2.6px/frame steps 3,2,3,3,2 instead of jittering between truncations
+int paddle_pixel_x(phys_t x) {
+    return phys_round(x);
+}
+
+// Move the drawn paddle from old_x to new_x with one restored span and one fill span
+void draw_paddle_move(phys_t old_x, phys_t new_x) {
+    paddle_t *p_info = get_paddle_info();
+    int from = (paddle_drawn_x < 0) ? paddle_pixel_x(old_x) : paddle_drawn_x;
+    int to = paddle_pixel_x(new_x);
+    int w = p_info->paddle_width;
+    int y = p_info->paddle_y;
+    int h = p_info->paddle_height;
+
+    if (paddle_drawn_x >= 0 && from == to)
+        return;
+
+    if (paddle_drawn_x < 0) {
+        save_under_capture(&paddle_under, 0, y, SCREEN_WIDTH, h);
+        render_fill_rect(to, y, w, h, ~ST77XX_WHITE);
+    } else {
+        int delta = abs(to - from);
+        int erase_x, fill_x;
+        int span = min(delta, w); // Columns exposed on one side and covered on the other
+
+        if (to > from) {
+            erase_x = from;
+            fill_x = (delta < w) ? from + w : to;
+        } else {
+            erase_x = (delta < w) ? to + w : from;
+            fill_x = to;
+        }
+
+        save_under_restore(&paddle_under, erase_x, y, span, h);
+        render_fill_rect(fill_x, y, span, h, ~ST77XX_WHITE);
+    }
+
+    paddle_drawn_x = to;
+}
+
 // Update paddle position (to be called in loop)
-void movePaddleDraw(float direction) {
+void movePaddleDraw(phys_t direction) {
     paddle_t *p_info = get_paddle_info();
 
     // Save the old paddle position
-    float oldPaddleX = p_info->paddle_x;
+    phys_t oldPaddleX = p_info->paddle_x;
 
     // Update the paddle position
-    p_info->paddle_x += direction; // Move left or right
-    p_info->paddle_x = max(0.0f, min((float)(SCREEN_WIDTH - p_info->paddle_width), p_info->paddle_x)); // Keep in bounds
-
-    // Only redraw if the paddle has actually moved
-    if (oldPaddleX != p_info->paddle_x) {
-        // Overdraw the old paddle with a black box
-        if (p_info->paddle_x > oldPaddleX)
-            tft.fillRect(floor(oldPaddleX), p_info->paddle_y, ceil(p_info->paddle_x - oldPaddleX), p_info->paddle_height, ~ST77XX_BLACK);
-        else 
-            tft.fillRect(floor(p_info->paddle_x+p_info->paddle_width), p_info->paddle_y, ceil(oldPaddleX - p_info->paddle_x), p_info->paddle_height, ~ST77XX_BLACK);
-
-        // Draw the new paddle at the updated position
-        tft.fillRect(p_info->paddle_x, p_info->paddle_y, p_info->paddle_width, p_info->paddle_height, ~ST77XX_WHITE);
-    }
-}
+    p_info->paddle_x += direction * get_tick_scale(); // Move left or right, per-tick speed scaled to the tick rate
+    p_info->paddle_x = max(phys_t(0), min(phys_t(SCREEN_WIDTH - p_info->paddle_width), p_info->paddle_x)); // Keep in bounds
 
-void movePaddle(float direction) {
-    for (float i = 0; i < abs(direction); i++) {
-        if (direction > 0) {
-            movePaddleDraw(1);
-        } else {
-            movePaddleDraw(-1);
-        }
-    }
+    draw_paddle_move(oldPaddleX, p_info->paddle_x);
 }
 
+// Bring the drawn paddle up to date, a no-op when it hasn't moved
 void draw_paddle() {
     paddle_t *p_info = get_paddle_info();
-    tft.fillRect(p_info->paddle_x, p_info->paddle_y, p_info->paddle_width, p_info->paddle_height, ~ST77XX_WHITE);
+    draw_paddle_move(p_info->paddle_x, p_info->paddle_x);
 }
 
 // --- UI ---
+static void invalidate_launch_angle_indicator();
+
 void draw_rect(int x, int y, int w, int h, uint16_t color) {
     tft.fillRect(x, y, w, h, color);
 }
 
 
+// Everything drawn incrementally is about to be painted over
+static void reset_screen() {
+    // Screen is replaced whole, safe to drop any playfield scroll
+    if (tft.getScroll() != 0)
+        tft.setScroll(0);
+    sprite_invalidate_balls();
+    paddle_drawn_x = -1;
+    hud_invalidate();
+    invalidate_launch_angle_indicator();
+}
+
 void black_screen() {
+    reset_screen();
     tft.fillScreen(~ST77XX_BLACK);
 }
 
-void draw_leaderboard(int score, int max_score) {
-    black_screen();
-
-    tft.setTextColor(~ST77XX_WHITE); // Set text color to white
-    tft.setTextSize(2); // Text size 2
+// Full screen image from the asset bundle, false when the bundle doesn't have it
+static bool draw_screen_asset(asset_id id) {
+    const asset_entry_t *a = asset_find(id);
+    if (a == NULL || a->w != SCREEN_WIDTH || a->h != SCREEN_HEIGHT)
+        return false;
 
-    int charWidth = 6 * 2; // Each character is 12 pixels wide
-    int charHeight = 8 * 2; // Each character is 16 pixels tall
-    int textLength = 10; // "LOADING..." has 10 characters
-    int textWidth = textLength * charWidth;
-    int textHeight = charHeight;
-    
-    int x = (240 - textWidth) / 2;
-    int y = (320 - textHeight) / 2;
+    reset_screen();
+    return asset_draw(id, 0, 0);
+}
 
-    tft.setCursor(x, y);
-    tft.print("GAME OVER!");
+void draw_leaderboard(int score, int max_score) {
+    int charHeight = FONT_CHAR_H * 2; // Each character is 16 pixels tall
+    const char *title = "GAME OVER!";
+    int x = (SCREEN_WIDTH - font_text_width(title, 2)) / 2;
+    int y = (SCREEN_HEIGHT - charHeight) / 2;
+
+    // The bundled screen has the title, only the scores are drawn
+    if (!draw_screen_asset(ASSET_GAME_OVER)) {
+        black_screen();
+        font_draw_string(tft, x, y, title, ~ST77XX_WHITE, ~ST77XX_BLACK, 2);
+    }
 
-    tft.setTextSize(1);
     y += charHeight * 3;
-    charWidth = 6;
 
     char score_str[25];
 
     sprintf(score_str, "SCORE: %d", score);
+    x = (SCREEN_WIDTH - font_text_width(score_str, 1)) / 2;
+    font_draw_string(tft, x, y, score_str, ~ST77XX_WHITE, ~ST77XX_BLACK, 1);
+    y += FONT_CHAR_H;
 
-    textLength = strlen(score_str);
-    textWidth = textLength * charWidth;
-    x =  (240 - textWidth) / 2; 
-    tft.setCursor(x, y);
+    sprintf(score_str, "HIGH SCORE: %d", max_score);
+    x = (SCREEN_WIDTH - font_text_width(score_str, 1)) / 2;
+    font_draw_string(tft, x, y, score_str, ~ST77XX_WHITE, ~ST77XX_BLACK, 1);
+}
 
-    tft.printf(score_str);
-    y += 8;
 
-    sprintf(score_str, "HIGH SCORE: %d", max_score);
+// --- PAUSE MENU ---
+#define PAUSE_BOX_W 180
+#define PAUSE_BOX_H 36
+#define PAUSE_BOX_X ((SCREEN_WIDTH - PAUSE_BOX_W) / 2)
+#define PAUSE_BOX_Y 90
+#define PAUSE_BOX_SPACING 8
+#define BATT_TEXT_Y 2
+
+// What the menu currently shows, so updates only touch what changed
+typedef struct {
+    int selected;
+    char batt_str[10];
+} pause_menu_t;
 
-    textLength = strlen(score_str);
-    textWidth = textLength * charWidth;
-    x =  (240 - textWidth) / 2; 
-    tft.setCursor(x, y);
+static pause_menu_t pause_menu = { -1, "" };
+
+static const char* pause_options[PAUSE_OPTIONS] = { "Brightness", "LED", NULL, "Reset Game", "Restart Console" };
+
+// Label of an option, the profile box shows the active profile
+static const char *pause_option_label(int option) {
+    if (option == PAUSE_OPT_PROFILE)
+        return get_profile()->name;
+    return pause_options[option];
+}
+
+static int pause_box_y(int option) {
+    return PAUSE_BOX_Y + option * (PAUSE_BOX_H + PAUSE_BOX_SPACING);
+}
 
-    tft.printf(score_str);
+// Where the menu is drawn: the framebuffer's overlay, or straight onto the
+// panel if the framebuffer couldn't be allocated
+static Adafruit_GFX &pause_canvas() {
+    if (!fb_ready())
+        return tft;
+    FbCanvas &fb = get_framebuffer();
+    fb.setLayer(FB_LAYER_OVERLAY);
+    return fb;
 }
 
+// Draw one option box into the menu
+static void draw_pause_option(Adafruit_GFX &fb, int option, bool selected) {
+    int charHeight = FONT_CHAR_H * 2;
+    int box_y = pause_box_y(option);
+    uint16_t box_color = selected ? ~ST77XX_BLUE : ~ST77XX_BLACK;
 
+    fb.fillRect(PAUSE_BOX_X, box_y, PAUSE_BOX_W, PAUSE_BOX_H, box_color);
+    if (!selected)
+        fb.drawRect(PAUSE_BOX_X, box_y, PAUSE_BOX_W, PAUSE_BOX_H, ~ST77XX_WHITE);
+
+    const char *label = pause_option_label(option);
+    int text_x = PAUSE_BOX_X + (PAUSE_BOX_W - font_text_width(label, 2)) / 2;
+    int text_y = box_y + (PAUSE_BOX_H - charHeight) / 2;
+    font_draw_string(fb, text_x, text_y, label, ~ST77XX_WHITE, box_color, 2);
+}
+
+// Refresh the voltage readout, only if the text changed
 void draw_batt_volts() {
-    tft.setTextSize(1);
     char batt_buf[10];
     snprintf(batt_buf, sizeof(batt_buf), "%.2fV", battery_volts);
-    int batt_text_width = strlen(batt_buf) * 6; // 6 pixels per char at size 1
+    if (strcmp(batt_buf, pause_menu.batt_str) == 0)
+        return;
+
+    // Right aligned, padded to cover the old text since the glyphs are opaque
+    int text_len = max(strlen(batt_buf), strlen(pause_menu.batt_str));
+    char padded[12];
+    snprintf(padded, sizeof(padded), "%*s", text_len, batt_buf);
+    int batt_text_width = font_text_width(padded, 1);
+    int batt_x = SCREEN_WIDTH - batt_text_width - 2;
+
+    Adafruit_GFX &fb = pause_canvas();
+    font_draw_string(fb, batt_x, BATT_TEXT_Y, padded, ~ST77XX_WHITE, ~ST77XX_BLACK, 1);
+
+    fb_flush_rect(batt_x, BATT_TEXT_Y, batt_text_width, FONT_CHAR_H);
+    strcpy(pause_menu.batt_str, batt_buf);
+}
+
+// Capture the game into the framebuffer and dim it behind the menu
+// Without the memory for it the menu goes over a black screen instead
+void draw_pause_background() {
+    if (!fb_alloc()) {
+        tft.fillScreen(~ST77XX_BLACK);
+        return;
+    }
 
-    // Clear background behind old voltage
-    int batt_x = 240 - batt_text_width - 2;
-    int batt_y = 2;
-    tft.fillRect(batt_x, batt_y, batt_text_width + 4, 8, ~ST77XX_BLACK); // 6*chars wide, 8 pixels tall
+    FbCanvas &fb = get_framebuffer();
+    fb.setLayer(FB_LAYER_SCENE);
+    fb.fillScreen(~ST77XX_BLACK);
+    compose_scene(fb, 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT);
+    fb_dim_scene(FB_PAUSE_DIM);
+}
 
-    // Draw updated voltage
-    tft.setCursor(batt_x, batt_y);
-    tft.setTextColor(~ST77XX_WHITE);
-    tft.print(batt_buf);
+// Drop the framebuffer once the menu is gone
+void release_pause_background() {
+    fb_free();
+    pause_menu.selected = -1;
 }
 
+// Bring the game back at full brightness, without the menu
+// The scene is composed straight through the strip renderer, the framebuffer isn't needed for it
+void restore_pause_background() {
+    release_pause_background();
+    strip_render(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, compose_scene, ~ST77XX_BLACK);
+}
 
+// Draw the whole menu over the dimmed background
 void drawpausescreen(int selected_option) {
-    black_screen();
-    tft.setTextSize(2);
+    Adafruit_GFX &fb = pause_canvas();
 
     // Centered "PAUSED..." text
     const char* paused_text = "PAUSED...";
-    int charWidth = 6 * 2;
-    int charHeight = 8 * 2;
-    int textWidth = strlen(paused_text) * charWidth;
-    int paused_x = (240 - textWidth) / 2;
+    int paused_x = (SCREEN_WIDTH - font_text_width(paused_text, 2)) / 2;
     int paused_y = 60;
 
-    tft.setTextColor(~ST77XX_WHITE);
-    tft.setCursor(paused_x, paused_y);
-    tft.printf(paused_text);
+    font_draw_string(fb, paused_x, paused_y, paused_text, ~ST77XX_WHITE, ~ST77XX_BLACK, 2);
+
+    for (int i = 0; i < PAUSE_OPTIONS; i++)
+        draw_pause_option(fb, i, i == selected_option);
+
+    fb_flush();
+    pause_menu.selected = selected_option;
 
+    // Force the readout to be drawn on the fresh menu
+    pause_menu.batt_str[0] = '\0';
     draw_batt_volts();
+}
 
-    // Restore text size for menu
-    tft.setTextSize(2);
-
-    const char* options[] = { "Brightness", "LED", "Reset Game", "Restart Console" };
-    int box_width = 180;
-    int box_height = 40;
-    int box_x = (240 - box_width) / 2;
-    int first_box_y = 120;
-    int spacing = 10;
-
-    for (int i = 0; i < 4; i++) {
-        int box_y = first_box_y + i * (box_height + spacing);
-        if (i == selected_option) {
-            tft.fillRect(box_x, box_y, box_width, box_height, ~ST77XX_BLUE);
-            tft.setTextColor(~ST77XX_WHITE);
-        } else {
-            tft.fillRect(box_x, box_y, box_width, box_height, ~ST77XX_BLACK);
-            tft.drawRect(box_x, box_y, box_width, box_height, ~ST77XX_WHITE);
-            tft.setTextColor(~ST77XX_WHITE);
-        }
+// Repaint one box after its label changed
+void redraw_pause_option(int option) {
+    draw_pause_option(pause_canvas(), option, option == pause_menu.selected);
+    fb_flush_rect(PAUSE_BOX_X, pause_box_y(option), PAUSE_BOX_W, PAUSE_BOX_H);
+}
+
+// Move the highlight, only the two affected boxes are repainted
+void draw_pause_selection(int selected_option) {
+    if (selected_option == pause_menu.selected)
+        return;
 
-        int text_x = box_x + (box_width - strlen(options[i]) * charWidth) / 2;
-        int text_y = box_y + (box_height - charHeight) / 2;
-        tft.setCursor(text_x, text_y);
-        tft.print(options[i]);
+    Adafruit_GFX &fb = pause_canvas();
+    int old_option = pause_menu.selected;
+
+    if (old_option >= 0) {
+        draw_pause_option(fb, old_option, false);
+        fb_flush_rect(PAUSE_BOX_X, pause_box_y(old_option), PAUSE_BOX_W, PAUSE_BOX_H);
     }
+    draw_pause_option(fb, selected_option, true);
+    fb_flush_rect(PAUSE_BOX_X, pause_box_y(selected_option), PAUSE_BOX_W, PAUSE_BOX_H);
+
+    pause_menu.selected = selected_option;
 }
 
 
 
-void drawloadtext() {
-    tft.setTextColor(~ST77XX_WHITE); // Set text color to white
-    tft.setTextSize(2); // Text size 2
-
-    int charWidth = 6 * 2; // Each character is 12 pixels wide
-    int charHeight = 8 * 2; // Each character is 16 pixels tall
-    int textLength = 10; // "LOADING..." has 10 characters
-    int textWidth = textLength * charWidth;
-    int textHeight = charHeight;
-    
-    int x = (240 - textWidth) / 2;
-    int y = (320 - textHeight) / 2;
+// Centre a line of size 2 text on the screen, from the bundle when it's there
+static void draw_centered_text(const char *text, asset_id id) {
+    const asset_entry_t *a = asset_find(id);
+    if (a != NULL && asset_draw(id, (SCREEN_WIDTH - a->w) / 2, (SCREEN_HEIGHT - a->h) / 2))
+        return;
 
-    tft.setCursor(x, y);
-    tft.print("LOADING...");
+    int x = (SCREEN_WIDTH - font_text_width(text, 2)) / 2;
+    int y = (SCREEN_HEIGHT - FONT_CHAR_H * 2) / 2;
+    font_draw_string(tft, x, y, text, ~ST77XX_WHITE, ~ST77XX_BLACK, 2);
 }
 
-void draw_start_text() {
-    tft.setTextColor(~ST77XX_WHITE); // Set text color to white
-    tft.setTextSize(2); // Text size 2
-
-    int charWidth = 6 * 2; // Each character is 12 pixels wide
-    int charHeight = 8 * 2; // Each character is 16 pixels tall
-    int textLength = 7; // "LOADING..." has 10 characters
-    int textWidth = textLength * charWidth;
-    int textHeight = charHeight;
-    
-    int x = (240 - textWidth) / 2;
-    int y = (320 - textHeight) / 2;
+void drawloadtext() {
+    draw_centered_text("LOADING...", ASSET_LOADING);
+}
 
-    tft.setCursor(x, y);
-    tft.print("PRESS A");
+void draw_start_text() {
+    draw_centered_text("PRESS A", ASSET_PRESS_A);
 }
 
-void draw_header() {
+// --- SCENE ---
+// Everything compose_scene reads, copied so a queued repaint shows the frame it
+// was queued in even while the game is already simulating the next one
+typedef struct {
+    int16_t brick_rows, brick_w, brick_h, brick_spacing; // Field geometry, the level's brick table stays behind
+    int16_t brick_x, brick_y;
+    brick_board_t board;
+    int level_index;
+    int points;
+    int lives;
+    int num_balls;
+    int16_t ball_x[BALL_POOL_SIZE], ball_y[BALL_POOL_SIZE];
+    uint8_t ball_radius[BALL_POOL_SIZE];
+    int num_powerups;
+    int16_t powerup_x[MAX_POWERUPS], powerup_y[MAX_POWERUPS];
+    powerup_id powerup_ids[MAX_POWERUPS];
+    int paddle_x, paddle_y, paddle_w, paddle_h;
+} scene_t;
+
+// Snapshots for frames still in the render queue
+static scene_t scene_slots[RENDER_SCENE_SLOTS];
+static int next_scene_slot = 0;
+
+// Level, bricks and HUD values, what compose_scenery_from reads
+static void capture_scenery_into(scene_t *s) {
     game_t *g_info = get_game_info();
+    const LevelInfo *level = &g_info->current_level;
+
+    s->brick_rows = level->brickRows;
+    s->brick_w = level->brickWidth;
+    s->brick_h = level->brickHeight;
+    s->brick_spacing = level->brickSpacing;
+    s->brick_x = level->brickOffsetX;
+    s->brick_y = level->brickOffsetY;
+    s->board = *get_brick_board();
+    s->level_index = g_info->current_level_index;
+    s->points = g_info->points;
+    s->lives = g_info->lives;
+}
 
-    tft.fillRect(0, 0, tft.width(), HEADER_HEIGHT, ~ST77XX_BLUE); // Draw header background
-    tft.setTextColor(~ST77XX_WHITE);
-    tft.setTextSize(1);
+static void capture_scene_into(scene_t *s) {
+    ball_pool_t *pool = get_ball_pool();
+    paddle_t *p_info = get_paddle_info();
+
+    capture_scenery_into(s);
+    s->num_balls = 0;
+    for (int i = 0; i < pool->end; i++) {
+        if (!(pool->flags[i] & BALL_LIVE))
+            continue;
+        s->ball_x[s->num_balls] = phys_to_int(pool->x[i]);
+        s->ball_y[s->num_balls] = phys_to_int(pool->y[i]);
+        s->ball_radius[s->num_balls] = pool->radius[i];
+        s->num_balls++;
+    }
+    s->num_powerups = 0;
+    for (int i = 0; i < MAX_POWERUPS; i++) {
+        const powerup_instance *p = &get_powerup_state()->active_powerups[i];
+        if (!p->active)
+            continue;
+        s->powerup_x[s->num_powerups] = (int)p->x;
+        s->powerup_y[s->num_powerups] = (int)p->y;
+        s->powerup_ids[s->num_powerups] = p->id;
+        s->num_powerups++;
+    }
+    s->paddle_x = paddle_pixel_x(p_info->paddle_x);
+    s->paddle_y = p_info->paddle_y;
+    s->paddle_w = p_info->paddle_width;
+    s->paddle_h = p_info->paddle_height;
+}
+
+// Snapshot the scene for this frame's repaints, returns the slot to pass to render_region
+// Slots are reused after RENDER_SCENE_SLOTS frames, the frame fence keeps that many at most in flight
+uint8_t capture_scene() {
+    uint8_t slot = next_scene_slot;
+    capture_scene_into(&scene_slots[slot]);
+    next_scene_slot = (next_scene_slot + 1) % RENDER_SCENE_SLOTS;
+    return slot;
+}
+
+// Draw the header onto any GFX target (panel or strip canvas)
+static void draw_header_to(Adafruit_GFX &g, const scene_t *s) {
+    char text[HUD_FIELD_LEN + 8];
+
+    g.fillRect(0, 0, SCREEN_WIDTH, HEADER_HEIGHT, ~ST77XX_BLUE); // Draw header background
 
     // Draw Level
-    tft.setCursor(5, 5);
-    tft.print("Level: ");
-    tft.print(g_info->current_level_index + 1);
+    snprintf(text, sizeof(text), "Level: %d", s->level_index + 1);
+    font_draw_string(g, HUD_LEVEL_X, HUD_TEXT_Y, text, ~ST77XX_WHITE, ~ST77XX_BLUE, 1);
 
     // Draw Points
-    tft.setCursor(80, 5);
-    tft.print("Points: ");
-    tft.print(g_info->points);
+    snprintf(text, sizeof(text), "Points: %d", s->points);
+    font_draw_string(g, HUD_POINTS_X, HUD_TEXT_Y, text, ~ST77XX_WHITE, ~ST77XX_BLUE, 1);
 
     // Draw Lives as balls
-    int livesX = 180; // Starting X position for lives
-    int livesY = 4;   // Y position for lives
-    int ballRadius = 3; // Ball size
-
     for (int i = 0; i < MAX_LIVES; i++) {
-        if (i < g_info->lives) {
-            if (i < STARTER_LIVES)
-                tft.fillCircle(livesX + (i * 10), livesY + ballRadius, ballRadius, ~ST77XX_WHITE); // Filled for active life
-            else 
-                tft.fillCircle(livesX + (i * 10), livesY + ballRadius, ballRadius, ~ST77XX_GREEN); // Filled for active life
-        } else if (i < STARTER_LIVES) {
-            tft.drawCircle(livesX + (i * 10), livesY + ballRadius, ballRadius, ~0x5A5A); // Outline for lost life
-        } 
+        hud_draw_life(g, i, s->lives);
     }
 }
 
-void draw_launch_angle_indicator(uint16_t color) {
-    ball_t *b_info = get_ball_info();
+void draw_header() {
+    static scene_t live;
+    capture_scenery_into(&live);
+    draw_header_to(tft, &live);
+    hud_sync();
+}
 
-    int indicatorLength = 20; // Length of the indicator
-    
-    // Convert angle to radians
-    double angleRad = b_info->launch_angle * M_PI / 180.0;
-    
-    // Ball position (assuming it's at the center of the paddle)
-    int ballX = b_info->x;
-    int ballY = b_info->y;
+// --- LAUNCH INDICATOR ---
+#define INDICATOR_LENGTH 20
+#define INDICATOR_ANGLES ((MAX_LAUNCH_ANGLE - MIN_LAUNCH_ANGLE) / LAUNCH_ANGLE_STEP + 1)
+#define INDICATOR_MAX_RUNS (INDICATOR_LENGTH + 1)
+
+// Horizontal run of indicator pixels, relative to the ball centre
+typedef struct {
+    int8_t dy;
+    int8_t x;
+    int8_t len;
+} indicator_run_t;
+
+typedef struct {
+    indicator_run_t runs[INDICATOR_MAX_RUNS];
+    int num_runs;
+} indicator_shape_t;
+
+// What is currently on screen
+typedef struct {
+    bool drawn;
+    int x, y;
+    int angle_idx;
+} indicator_state_t;
+
+static indicator_shape_t indicator_table[INDICATOR_ANGLES];
+static indicator_state_t indicator = { false, 0, 0, 0 };
+
+// Rasterise the line for every launch angle once, as horizontal runs
+// Pixels under the ball are left out so erasing never cuts into it
+static void build_indicator_table() {
+    int radius = get_ball_info()->radius;
+
+    for (int i = 0; i < INDICATOR_ANGLES; i++) {
+        double angleRad = (MIN_LAUNCH_ANGLE + i * LAUNCH_ANGLE_STEP) * M_PI / 180.0;
+        int x1 = lround(INDICATOR_LENGTH * cos(angleRad));
+        int y1 = -lround(INDICATOR_LENGTH * sin(angleRad));
+        indicator_shape_t *shape = &indicator_table[i];
+        shape->num_runs = 0;
+
+        // Bresenham from the centre to the end point
+        int dx = abs(x1), sx = x1 >= 0 ? 1 : -1;
+        int dy = -abs(y1), sy = y1 >= 0 ? 1 : -1;
+        int err = dx + dy;
+        int x = 0, y = 0;
+        while (true) {
+            if (x * x + y * y > radius * radius) {
+                indicator_run_t *last = shape->num_runs ? &shape->runs[shape->num_runs - 1] : NULL;
+                if (last && last->dy == y && (x == last->x + last->len || x == last->x - 1)) {
+                    // Extend the current run left or right
+                    if (x < last->x)
+                        last->x = x;
+                    last->len++;
+                } else if (shape->num_runs < INDICATOR_MAX_RUNS) {
+                    shape->runs[shape->num_runs++] = { (int8_t)y, (int8_t)x, 1 };
+                }
+            }
+            if (x == x1 && y == y1)
+                break;
+            int e2 = 2 * err;
+            if (e2 >= dy) { err += dy; x += sx; }
+            if (e2 <= dx) { err += dx; y += sy; }
+        }
+    }
+}
 
-    // Calculate the new end point of the indicator
-    int endX = ballX + indicatorLength * cos(angleRad);
-    int endY = ballY - indicatorLength * sin(angleRad);
+static int indicator_index(float angle) {
+    int idx = lroundf((angle - MIN_LAUNCH_ANGLE) / LAUNCH_ANGLE_STEP);
+    return max(0, min(INDICATOR_ANGLES - 1, idx));
+}
 
-    // Erase previous line if it exists
-    if (b_info->prev_end_x != -1 && b_info->prev_end_y != -1 && (b_info->prev_end_x != endX || b_info->prev_end_y != endY)) {
-        tft.drawLine(ballX, ballY, b_info->prev_end_x, b_info->prev_end_y, ~ST77XX_BLACK);
-    }
+static void draw_indicator_shape(int x, int y, int idx, uint16_t color) {
+    indicator_shape_t *shape = &indicator_table[idx];
+    for (int i = 0; i < shape->num_runs; i++)
+        render_hspan(x + shape->runs[i].x, y + shape->runs[i].dy, shape->runs[i].len, color);
+}
+
+// Redraws only when the angle or the ball position changed
+void draw_launch_angle_indicator(uint16_t color) {
+    ball_t *b_info = get_ball_info();
+    ball_pool_t *pool = get_ball_pool();
+    int x = phys_to_int(pool->x[BALL_SERVE]);
+    int y = phys_to_int(pool->y[BALL_SERVE]);
+    int idx = indicator_index(b_info->launch_angle);
+
+    if (indicator.drawn && indicator.x == x && indicator.y == y && indicator.angle_idx == idx)
+        return;
+
+    if (indicator.drawn)
+        draw_indicator_shape(indicator.x, indicator.y, indicator.angle_idx, ~ST77XX_BLACK);
+    draw_indicator_shape(x, y, idx, color);
+
+    indicator.drawn = true;
+    indicator.x = x;
+    indicator.y = y;
+    indicator.angle_idx = idx;
+}
 
-    // Draw new indicator line
-    tft.drawLine(ballX, ballY, endX, endY, ~ST77XX_WHITE);
+// Screen under the indicator was cleared
+static void invalidate_launch_angle_indicator() {
+    indicator.drawn = false;
+}
 
-    // Store new end position
-    b_info->prev_end_x = endX;
-    b_info->prev_end_y = endY;
+void clear_launch_angle_indicator() {
+    if (!indicator.drawn)
+        return;
+    draw_indicator_shape(indicator.x, indicator.y, indicator.angle_idx, ~ST77XX_BLACK);
+    indicator.drawn = false;
 }
 
 void increaseLaunchAngle() {
-    //draw_launch_angle_indicator(~ST77XX_BLACK);
     ball_t *b_info = get_ball_info();
 
-    if (b_info->launch_angle < 150) {
-        b_info->launch_angle += 5;
+    if (b_info->launch_angle < MAX_LAUNCH_ANGLE) {
+        b_info->launch_angle += LAUNCH_ANGLE_STEP;
         draw_launch_angle_indicator();
     }
 }
 
 void decreaseLaunchAngle() {
-    //draw_launch_angle_indicator(~ST77XX_BLACK);
     ball_t *b_info = get_ball_info();
-    if (b_info->launch_angle > 30) {
-        b_info->launch_angle -= 5;
+    if (b_info->launch_angle > MIN_LAUNCH_ANGLE) {
+        b_info->launch_angle -= LAUNCH_ANGLE_STEP;
         draw_launch_angle_indicator();
     }
 }
 
 // --- BALL ---
-void draw_ball(int x, int y, int old_x, int old_y, int radius) {
+// Only the pixels that differ from the last drawn position are written,
+// vacated ones get their scenery back from the save-under
+void draw_ball(int slot, int x, int y, int radius) {
+    sprite_move_ball(slot, x, y, radius, ~ST77XX_WHITE);
+}
 
-    if (x != old_x || y != old_y)
-        tft.fillCircle(old_x, old_y, radius, ~ST77XX_BLACK);
-    tft.fillCircle(x, y, radius, ~ST77XX_WHITE);
+// Ball left play, put back what it covered
+void erase_ball(int slot) {
+    sprite_erase_ball(slot);
 }
 
 // --- BRICKS ---
@@ -441,32 +737,80 @@ uint16_t getBrickColor(int durability) {
 void draw_brick(int row, int col, bool overridecol, uint16_t color) {
     game_t *g_info = get_game_info();
 
-    int durability = g_info->current_level.bricks[row][col];
+    int durability = board_durability(get_brick_board(), row, col);
     int bx = g_info->current_level.brickOffsetX + col * (g_info->current_level.brickWidth + g_info->current_level.brickSpacing);
     int by = g_info->current_level.brickOffsetY + row * (g_info->current_level.brickHeight + g_info->current_level.brickSpacing);
 
     if (!overridecol && durability > 0)
-        tft.fillRect(bx, by, g_info->current_level.brickWidth, g_info->current_level.brickHeight, getBrickColor(durability));
+        render_fill_rect(bx, by, g_info->current_level.brickWidth, g_info->current_level.brickHeight, getBrickColor(durability));
     else if (overridecol)
-        tft.fillRect(bx, by, g_info->current_level.brickWidth, g_info->current_level.brickHeight, color);
+        render_fill_rect(bx, by, g_info->current_level.brickWidth, g_info->current_level.brickHeight, color);
     
 }
 
+// Width of the brick field, from the left edge of the first column to the right edge of the last
+int brick_field_width() {
+    game_t *g_info = get_game_info();
+    int cols = g_info->current_level.brickCols;
+    return min(cols * (g_info->current_level.brickWidth + g_info->current_level.brickSpacing) - g_info->current_level.brickSpacing, SCREEN_WIDTH);
+}
+
 void clearBricks() {
     game_t *g_info = get_game_info();
-    for (int r = 0; r < g_info->current_level.brickRows; r++) {
-        for (int c = 0; c < g_info->current_level.brickCols; c++) {
-            draw_brick(r, c, true);
+    int rows = g_info->current_level.brickRows;
+    int height = rows * (g_info->current_level.brickHeight + g_info->current_level.brickSpacing) - g_info->current_level.brickSpacing;
+    tft.fillRect(g_info->current_level.brickOffsetX, g_info->current_level.brickOffsetY, brick_field_width(), height, ~ST77XX_BLACK);
+}
+
+// One scanline of a brick row, bricks and gaps
+static uint16_t brick_line[SCREEN_WIDTH];
+
+// Stream a whole brick row, including the gaps between bricks and the spacing
+// below it, through a single address window
+void draw_brick_row(int row) {
+    game_t *g_info = get_game_info();
+    int cols = g_info->current_level.brickCols;
+    int brickW = g_info->current_level.brickWidth;
+    int brickH = g_info->current_level.brickHeight;
+    int spacing = g_info->current_level.brickSpacing;
+    int rowW = brick_field_width();
+
+    // Build the scanline once, every line of the row is identical
+    const brick_board_t *board = get_brick_board();
+    int i = 0;
+    for (int c = 0; c < cols && i < rowW; c++) {
+        uint16_t color = getBrickColor(board_durability(board, row, c));
+        for (int k = 0; k < brickW && i < rowW; k++)
+            brick_line[i++] = color;
+        for (int k = 0; k < spacing && i < rowW; k++)
+            brick_line[i++] = ~ST77XX_BLACK;
+    }
+
+    int bx = g_info->current_level.brickOffsetX;
+    int by = g_info->current_level.brickOffsetY + row * (brickH + spacing);
+    int gapH = (row < g_info->current_level.brickRows - 1) ? spacing : 0;
+
+    // One window per run of panel rows, a single run unless the playfield is scrolled
+    scroll_run_t runs[SCROLL_MAX_RUNS];
+    int n = tft.mapRows(by, brickH + gapH, runs);
+
+    tft.startWrite();
+    for (int i = 0; i < n; i++) {
+        tft.setAddrWindow(bx, runs[i].mem_y, rowW, runs[i].h);
+        for (int y = runs[i].y; y < runs[i].y + runs[i].h; y++) {
+            if (y < by + brickH)
+                tft.writePixels(brick_line, rowW);
+            else
+                tft.writeColor(~ST77XX_BLACK, rowW);
         }
     }
+    tft.endWrite();
 }
 
 void draw_all_bricks() {
     game_t *g_info = get_game_info();
     for (int r = 0; r < g_info->current_level.brickRows; r++) {
-        for (int c = 0; c < g_info->current_level.brickCols; c++) {
-            draw_brick(r, c);
-        }
+        draw_brick_row(r);
     }
 }
 
@@ -475,40 +819,145 @@ void draw_loss_boundary() {
     tft.drawLine(0, MIN_BRICK_HEIGHT, SCREEN_WIDTH, MIN_BRICK_HEIGHT, ~ST77XX_RED);
 }
 
+// Compose the static scenery, everything but the moving sprites
+static void compose_scenery_from(Adafruit_GFX &g, const scene_t *s, int x, int y, int w, int h) {
+    int y1 = y + h;
+
+    if (y < HEADER_HEIGHT)
+        draw_header_to(g, s);
+
+    // Live bricks in the band
+    int brickW = s->brick_w;
+    int brickH = s->brick_h;
+    int spacing = s->brick_spacing;
+    for (int r = 0; r < s->brick_rows; r++) {
+        int by = s->brick_y + r * (brickH + spacing);
+        if (by >= y1 || by + brickH <= y)
+            continue;
+
+        // Only the live bits of the row, lowest column first
+        uint8_t live = board_row_live(&s->board, r);
+        while (live) {
+            int c = __builtin_ctz(live);
+            live &= live - 1;
+            int bx = s->brick_x + c * (brickW + spacing);
+            g.fillRect(bx, by, brickW, brickH, getBrickColor(board_durability(&s->board, r, c)));
+        }
+    }
+
+    if (MIN_BRICK_HEIGHT >= y && MIN_BRICK_HEIGHT < y1)
+        g.drawFastHLine(0, MIN_BRICK_HEIGHT, SCREEN_WIDTH, ~ST77XX_RED);
+}
+
+// Compose everything that is on screen during play into a strip
+static void compose_scene_from(Adafruit_GFX &g, const scene_t *s, int x, int y, int w, int h) {
+    compose_scenery_from(g, s, x, y, w, h);
+    for (int i = 0; i < s->num_powerups; i++)
+        powerup_draw_icon(g, s->powerup_ids[i], s->powerup_x[i], s->powerup_y[i]);
+    for (int i = 0; i < s->num_balls; i++)
+        sprite_fill_circle(g, s->ball_x[i], s->ball_y[i], s->ball_radius[i], ~ST77XX_WHITE);
+    g.fillRect(s->paddle_x, s->paddle_y, s->paddle_w, s->paddle_h, ~ST77XX_WHITE);
+}
+
+// Compose the live game state, for callers drawing synchronously
+void compose_scene(Adafruit_GFX &g, int x, int y, int w, int h) {
+    static scene_t live;
+    capture_scene_into(&live);
+    compose_scene_from(g, &live, x, y, w, h);
+}
+
+// Compose the live scenery only, what a sprite save-under captures
+// Runs for every ball sprite that moves, so it skips copying the ball pool
+void compose_background(Adafruit_GFX &g, int x, int y, int w, int h) {
+    static scene_t live;
+    capture_scenery_into(&live);
+    compose_scenery_from(g, &live, x, y, w, h);
+}
+
+// Snapshot used by the region being repainted, only touched by the render task
+static const scene_t *region_scene = NULL;
+
+static void compose_region(Adafruit_GFX &g, int x, int y, int w, int h) {
+    compose_scene_from(g, region_scene, x, y, w, h);
+}
+
+// Repaint a region from a scene snapshot as one composed transfer, runs on the render task
+// The last band may still be flushing on return, the render task finishes it before other draws
+void draw_scene_region(int x, int y, int w, int h, uint8_t scene_slot) {
+    region_scene = &scene_slots[scene_slot];
+    strip_render_async(x, y, w, h, compose_region, ~ST77XX_BLACK);
+}
+
+// Queue a repaint of everything inside a region, clipped to the screen
+// Returns the number of pixels that will be pushed to the display
+uint32_t draw_dirty_region(int x, int y, int w, int h, uint8_t scene_slot) {
+    int x0 = max(x, 0);
+    int y0 = max(y, 0);
+    int x1 = min(x + w, SCREEN_WIDTH);
+    int y1 = min(y + h, SCREEN_HEIGHT);
+    if (x1 <= x0 || y1 <= y0)
+        return 0;
+
+    render_region(x0, y0, x1 - x0, y1 - y0, scene_slot);
+    return (x1 - x0) * (y1 - y0);
+}
+
 void move_bricks_down(int amount) {
     game_t *g_info = get_game_info();
 
-    clearBricks();
+#ifdef USE_HW_SCROLL
+    // Scroll the playfield band in hardware, only the rows scrolled in at the top need painting
+    // Skipped in attract mode, the start text sits inside the band and must not move
+    if (g_info->game_started) {
+        sprite_erase_balls();
+        erase_powerups();
+        g_info->current_level.brickOffsetY += BRICK_INCR_AMT;
+        grid_rebuild(&g_info->current_level);
+        tft.scrollBy(BRICK_INCR_AMT);
+        tft.fillRect(0, SCROLL_TOP, SCREEN_WIDTH, BRICK_INCR_AMT, ~ST77XX_BLACK);
+        return;
+    }
+#endif
+
+    // Falling powerups are drawn again over the moved rows on their next update
+    erase_powerups();
+
+    // Rows are streamed with their gaps, so only the strip the field moved off of needs clearing
+    int top = g_info->current_level.brickOffsetY;
     g_info->current_level.brickOffsetY += BRICK_INCR_AMT;
+    grid_rebuild(&g_info->current_level);
+    tft.fillRect(g_info->current_level.brickOffsetX, top, brick_field_width(), BRICK_INCR_AMT, ~ST77XX_BLACK);
+
     draw_all_bricks();
 }
 
 // -- POWERUPS ---
-void drawMissile(int x, int y) {
-    tft.fillTriangle(x, y, x - 3, y + 8, x + 3, y + 8, ~ST77XX_RED); // Rocket tip
-    tft.fillRect(x - 2, y + 8, 4, 10, ~ST77XX_WHITE); // Rocket body
-    tft.fillTriangle(x - 3, y + 18, x + 3, y + 18, x, y + 22, ~ST77XX_ORANGE); // Rocket flames
+// Icons are drawn centred on (x, y), onto the panel or a sprite canvas
+void drawMissile(Adafruit_GFX &g, int x, int y) {
+    g.fillTriangle(x, y, x - 3, y + 8, x + 3, y + 8, ~ST77XX_RED); // Rocket tip
+    g.fillRect(x - 2, y + 8, 4, 10, ~ST77XX_WHITE); // Rocket body
+    g.fillTriangle(x - 3, y + 18, x + 3, y + 18, x, y + 22, ~ST77XX_ORANGE); // Rocket flames
 }
 
-void drawExtraBalls(int x, int y) {
-    tft.fillCircle(x - 4, y, 2, ~ST77XX_CYAN);
-    tft.fillCircle(x,     y, 2, ~ST77XX_CYAN);
-    tft.fillCircle(x + 4, y, 2, ~ST77XX_CYAN);
+void drawExtraBalls(Adafruit_GFX &g, int x, int y) {
+    g.fillCircle(x - 4, y, 2, ~ST77XX_CYAN);
+    g.fillCircle(x,     y, 2, ~ST77XX_CYAN);
+    g.fillCircle(x + 4, y, 2, ~ST77XX_CYAN);
 }
 
-void drawLargeBall(int x, int y) {
-    tft.fillCircle(x, y, 4, ~ST77XX_YELLOW); // 8px diameter fits in 10x10
+void drawLargeBall(Adafruit_GFX &g, int x, int y) {
+    sprite_fill_circle(g, x, y, 4, ~ST77XX_YELLOW); // 8px diameter fits in 10x10
 }
 
-void drawLaser(int x, int y) {
-    tft.fillRoundRect(x - 4, y - 2, 8, 4, 2, ~ST77XX_RED); // fits inside 10x10 centered
+void drawLaser(Adafruit_GFX &g, int x, int y) {
+    g.fillRoundRect(x - 4, y - 2, 8, 4, 2, ~ST77XX_RED); // fits inside 10x10 centered
 }
 
-void drawPlusOne(int x, int y) {
-    tft.setTextSize(1);
-    tft.setTextColor(~ST77XX_GREEN);
-    tft.setCursor(x - 3, y - 4); // Center 6x8 character in 10x10
-    tft.print("+");
+void drawPlusOne(Adafruit_GFX &g, int x, int y) {
+    g.setTextSize(1);
+    g.setTextColor(~ST77XX_GREEN);
+    g.setCursor(x - 3, y - 4); // Center 6x8 character in 10x10
+    g.print("+");
 }
 
 
@@ -517,6 +966,118 @@ void set_brightness(uint32_t duty) {
     ledcWrite(PWM_CHANNEL, duty);
 }
 
+// --- SPI CLOCK ---
+#ifndef DISPLAY_BACKEND_TFT_ESPI
+// Probe candidates, slowest first, all whole divisions of the ESP32's 80MHz
+// SPI clock. Anything in between rounds down to the one below it
+static const uint32_t spi_candidates[] = { 26666667, 40000000, 80000000 };
+#define SPI_CANDIDATES (int)(sizeof(spi_candidates) / sizeof(spi_candidates[0]))
+
+static uint16_t tune_pattern[SPI_TUNE_PATTERN_W * SPI_TUNE_PATTERN_H];
+static uint16_t tune_readback[SPI_TUNE_PATTERN_W * SPI_TUNE_PATTERN_H];
+
+// Alternating and pseudo-random bits, so every bit line toggles at full rate
+// Each pass gets its own phase and LFSR seed
+static void fill_tune_pattern(int pass) {
+    uint16_t lfsr = 0xACE1 ^ (pass * 0x1F35);
+    if (lfsr == 0)
+        lfsr = 0xACE1;
+    uint16_t alt = (pass & 1) ? 0x5555 : 0xAAAA;
+    for (int i = 0; i < SPI_TUNE_PATTERN_W * SPI_TUNE_PATTERN_H; i++) {
+        if (i < SPI_TUNE_PATTERN_W) {
+            tune_pattern[i] = (i & 1) ? alt : (uint16_t)~alt;
+        } else {
+            lfsr = (lfsr >> 1) ^ (-(lfsr & 1) & 0xB400);
+            tune_pattern[i] = lfsr;
+        }
+    }
+}
+
+// Write the pattern at hz and read it back at the safe read clock
+static bool spi_pattern_passes(uint32_t hz) {
+    int n = SPI_TUNE_PATTERN_W * SPI_TUNE_PATTERN_H;
+
+    tft.setSPISpeed(hz);
+    tft.startWrite();
+    tft.setAddrWindow(0, 0, SPI_TUNE_PATTERN_W, SPI_TUNE_PATTERN_H);
+    tft.writePixels(tune_pattern, n);
+    tft.endWrite();
+
+    tft.setSPISpeed(SPI_READ_SPEED);
+    tft.readRect(0, 0, SPI_TUNE_PATTERN_W, SPI_TUNE_PATTERN_H, tune_readback);
+
+    for (int i = 0; i < n; i++) {
+        if (tune_readback[i] != tune_pattern[i]) {
+            ESP_LOGW("DISPLAY", "SPI %u HZ FAIL AT PIXEL %d (0x%04X != 0x%04X)", (unsigned)hz, i, tune_readback[i], tune_pattern[i]);
+            return false;
+        }
+    }
+    return true;
+}
+
+// A clock passes when every one of SPI_TUNE_PASSES patterns reads back clean
+static bool spi_clock_passes(uint32_t hz) {
+    for (int pass = 0; pass < SPI_TUNE_PASSES; pass++) {
+        fill_tune_pattern(pass);
+        if (!spi_pattern_passes(hz))
+            return false;
+    }
+    return true;
+}
+
+// Step the clock up until a candidate fails, then back off one step from the
+// highest that passed, a clock that only just passes here can fail warm or on
+// a marginal board. Returns 0 when there is no readback to probe with
+static uint32_t probe_spi_clock() {
+    // No readback at the known-good clock means RAMRD isn't available (MISO not wired)
+    fill_tune_pattern(0);
+    if (!spi_pattern_passes(SPI_SPEED)) {
+        ESP_LOGW("DISPLAY", "RAMRD READBACK UNAVAILABLE, KEEPING %u HZ", (unsigned)SPI_SPEED);
+        return 0;
+    }
+
+    int highest = -1;
+    for (int i = 0; i < SPI_CANDIDATES; i++) {
+        if (!spi_clock_passes(spi_candidates[i]))
+            break;
+        highest = i;
+    }
+    ESP_LOGI("DISPLAY", "SPI PROBE: HIGHEST PASS %u HZ", highest >= 0 ? (unsigned)spi_candidates[highest] : (unsigned)SPI_SPEED);
+    return highest > 0 ? spi_candidates[highest - 1] : SPI_SPEED;
+}
+#endif
+
+// Use the stored panel clock if it still reads back clean, or probe for one
+// The store is dropped by a firmware update (see get_spi_clock) or a failed check
+static void tune_spi_clock() {
+#ifdef DISPLAY_BACKEND_TFT_ESPI
+    // TFT_eSPI fixes its clock at build time (SPI_FREQUENCY)
+    ESP_LOGI("DISPLAY", "SPI CLOCK FIXED BY TFT_eSPI BUILD");
+#else
+    uint32_t stored = get_spi_clock();
+    if (stored != 0 && !spi_clock_passes(stored)) {
+        ESP_LOGW("DISPLAY", "STORED SPI CLOCK %u HZ FAILED READBACK, PROBING AGAIN", (unsigned)stored);
+        clear_spi_clock();
+        stored = 0;
+    }
+
+    if (stored != 0) {
+        spi_speed = stored;
+    } else {
+        uint32_t probed = probe_spi_clock();
+        if (probed != 0) {
+            spi_speed = probed;
+            set_spi_clock(spi_speed);
+        } else {
+            spi_speed = SPI_SPEED;
+            clear_spi_clock();
+        }
+    }
+    tft.setSPISpeed(spi_speed);
+    ESP_LOGI("DISPLAY", "SPI CLOCK %u HZ%s", (unsigned)spi_speed, stored ? " (STORED)" : "");
+#endif
+}
+
 // --- INIT ---
 void display_init() {
     dbginfo.dbg_line = 10;
@@ -537,6 +1098,8 @@ void display_init() {
 
     tft.init(240, 320); // Display init
     tft.setRotation(2);
+    tune_spi_clock();
+    tft.setScrollArea(SCROLL_TOP, SCROLL_BOTTOM);
     tft.fillScreen(~ST77XX_BLACK);
 
     Serial.println(tft.width());
@@ -546,5 +1109,13 @@ void display_init() {
     ledcAttachPin(TFT_LED, PWM_CHANNEL);
     ledcWrite(PWM_CHANNEL, 255);
 
+    strip_init();
+    render_init();
+    sprite_init();
+    font_init();
+    powerups_init();
+    assets_init();
+    build_indicator_table();
+
     dbginfo.screen_init = true;
 }
\ No newline at end of file
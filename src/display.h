@@ -1,6 +1,7 @@
 #include "xtensa/xtensa_context.h"
 #include "Adafruit_ILI9341.h"
 #include "Adafruit_ST7789.h"
+#include "fixed.h"
 
 // Display pins
 #define TFT_CS   22
@@ -19,7 +20,28 @@
 #define HEADER_HEIGHT 15
 #define TOP_BUFFER 15
 #define DISPLAY_OK status & (1 << 10)
-#define SPI_SPEED 24000000 
+#define SPI_SPEED 24000000 // Known-good clock, the boot probe starts here
+#define SPI_READ_SPEED 6000000 // RAMRD and register reads
+#define SPI_TUNE_PATTERN_W 64
+#define SPI_TUNE_PATTERN_H 4
+#define SPI_TUNE_PASSES 8 // Clean readbacks, each a different pattern, a probed clock needs
+
+// Pause menu options
+#define PAUSE_OPTIONS 5
+#define PAUSE_OPT_BRIGHTNESS 0
+#define PAUSE_OPT_LED 1
+#define PAUSE_OPT_PROFILE 2
+#define PAUSE_OPT_RESET 3
+#define PAUSE_OPT_RESTART 4
+#define PADDLE_MAX_HEIGHT 8 // Rows kept in the paddle save-under
+
+// Display backend is picked in platformio.ini, see panel.h
+
+// Comment out to redraw the brick field on descent instead of scrolling it
+#define USE_HW_SCROLL
+
+// Uncomment to hold panel writes back until the refresh has passed them (GSCAN)
+// #define USE_BEAM_RACING
 
 #ifndef DISPLAY_H
 #define DISPLAY_H
@@ -31,6 +53,8 @@ typedef struct ili_9341 {
 
 // Function declarations
 uint8_t get_display_status();
+uint32_t get_spi_speed();
+void set_panel_refresh(uint8_t frctrl2);
 void set_dbg_line(int l);
 bool get_screen_init();
 void drawdebugtext(const char* text);
@@ -40,26 +64,41 @@ void draw_rect(int x, int y, int w, int h, uint16_t color);
 void black_screen();
 void draw_leaderboard(int score, int max_score);
 void draw_batt_volts();
+void draw_pause_background();
+void restore_pause_background();
+void release_pause_background();
 void drawpausescreen(int selected_option);
+void draw_pause_selection(int selected_option);
+void redraw_pause_option(int option);
 void draw_header();
 void draw_lowbatt_symbol();
-void draw_ball(int x, int y, int old_x, int old_y, int radius);
+void draw_ball(int slot, int x, int y, int radius);
+void erase_ball(int slot);
 void draw_brick(int row, int col, bool overridecol = false, uint16_t color = ~ST77XX_BLACK);
+void draw_brick_row(int row);
 void move_bricks_down(int amount);
 void draw_all_bricks();
 void draw_paddle();
 void increaseLaunchAngle();
 void decreaseLaunchAngle();
 void draw_launch_angle_indicator(uint16_t color = ~ST77XX_WHITE);
+void clear_launch_angle_indicator();
 void draw_loss_boundary();
+void compose_scene(Adafruit_GFX &g, int x, int y, int w, int h);
+void compose_background(Adafruit_GFX &g, int x, int y, int w, int h);
+uint8_t capture_scene();
+void draw_scene_region(int x, int y, int w, int h, uint8_t scene_slot);
+uint32_t draw_dirty_region(int x, int y, int w, int h, uint8_t scene_slot);
 void drawloadtext();
 void draw_start_text();
-void drawLargeBall(int x, int y);
-void drawLaser(int x, int y);
-void drawExtraBalls(int x, int y);
-void drawPlusOne(int x, int y);
-void movePaddleDraw(float direction);
-void movePaddle(float direction);
+void drawMissile(Adafruit_GFX &g, int x, int y);
+void drawLargeBall(Adafruit_GFX &g, int x, int y);
+void drawLaser(Adafruit_GFX &g, int x, int y);
+void drawExtraBalls(Adafruit_GFX &g, int x, int y);
+void drawPlusOne(Adafruit_GFX &g, int x, int y);
+void movePaddleDraw(phys_t direction);
+void draw_paddle_move(phys_t old_x, phys_t new_x);
+int paddle_pixel_x(phys_t x);
 void set_brightness(uint32_t duty);
 void display_init();
 
@@ -0,0 +1,80 @@
+#include <Arduino.h>
+#include <cmath>
+#include "fixed.h"
+
+// Physics number format
+// With USE_FIXED_PHYSICS every position, velocity and collision time is a
+// Q16.16 integer, and sqrt / sin / cos below are integer-only too, so the
+// same inputs give the same game on the ESP32 and on a host build. Without
+// it phys_t is float and these are the libm calls the game always used.
+
+#ifdef USE_FIXED_PHYSICS
+// sin(0..90 degrees) in Q16.16
+static const int32_t sin_table[91] = {
+    0, 1144, 2287, 3430, 4572, 5712, 6850, 7987,
+    9121, 10252, 11380, 12505, 13626, 14742, 15855, 16962,
+    18064, 19161, 20252, 21336, 22415, 23486, 24550, 25607,
+    26656, 27697, 28729, 29753, 30767, 31772, 32768, 33754,
+    34729, 35693, 36647, 37590, 38521, 39441, 40348, 41243,
+    42126, 42995, 43852, 44695, 45525, 46341, 47143, 47930,
+    48703, 49461, 50203, 50931, 51643, 52339, 53020, 53684,
+    54332, 54963, 55578, 56175, 56756, 57319, 57865, 58393,
+    58903, 59396, 59870, 60326, 60764, 61183, 61584, 61966,
+    62328, 62672, 62997, 63303, 63589, 63856, 64104, 64332,
+    64540, 64729, 64898, 65048, 65177, 65287, 65376, 65446,
+    65496, 65526, 65536,
+};
+
+// Digit-by-digit square root of raw << 16, exact to the last bit
+phys_t phys_sqrt(phys_t v) {
+    if (v.raw <= 0)
+        return phys_t(0);
+
+    uint64_t n = (uint64_t)v.raw << FIX_FRAC_BITS;
+    uint64_t root = 0;
+    uint64_t bit = 1ULL << 62;
+    while (bit > n)
+        bit >>= 2;
+
+    while (bit != 0) {
+        if (n >= root + bit) {
+            n -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return fix16::from_raw((int32_t)root);
+}
+
+phys_t phys_sin_deg(int deg) {
+    deg %= 360;
+    if (deg < 0)
+        deg += 360;
+
+    if (deg <= 90)
+        return fix16::from_raw(sin_table[deg]);
+    if (deg <= 180)
+        return fix16::from_raw(sin_table[180 - deg]);
+    if (deg <= 270)
+        return fix16::from_raw(-sin_table[deg - 180]);
+    return fix16::from_raw(-sin_table[360 - deg]);
+}
+
+phys_t phys_cos_deg(int deg) {
+    return phys_sin_deg(deg + 90);
+}
+#else
+phys_t phys_sqrt(phys_t v) {
+    return sqrt(v);
+}
+
+phys_t phys_sin_deg(int deg) {
+    return sin(deg * M_PI / 180.0);
+}
+
+phys_t phys_cos_deg(int deg) {
+    return cos(deg * M_PI / 180.0);
+}
+#endif
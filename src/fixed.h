@@ -0,0 +1,82 @@
+#include <Arduino.h>
+#include <stdint.h>
+
+// Uncomment for Q16.16 fixed-point physics, bit-identical on any target
+// #define USE_FIXED_PHYSICS
+
+#define FIX_FRAC_BITS 16
+#define FIX_ONE (1L << FIX_FRAC_BITS)
+
+#ifndef FIXED_H
+#define FIXED_H
+
+#ifdef USE_FIXED_PHYSICS
+// Q16.16 number, integer-only arithmetic
+// Products and quotients go through int64 and saturate instead of wrapping,
+// constants convert from float/double at compile time.
+struct fix16 {
+    int32_t raw;
+
+    constexpr fix16() : raw(0) {}
+    constexpr fix16(int v) : raw(v * FIX_ONE) {}
+    constexpr fix16(double v) : raw((int32_t)(v * FIX_ONE + (v < 0 ? -0.5 : 0.5))) {}
+    constexpr fix16(float v) : fix16((double)v) {}
+
+    static constexpr fix16 from_raw(int32_t r) { fix16 f; f.raw = r; return f; }
+    static constexpr fix16 saturate(int64_t r) {
+        return from_raw(r > INT32_MAX ? INT32_MAX : r < INT32_MIN ? INT32_MIN : (int32_t)r);
+    }
+
+    explicit operator int() const { return raw >> FIX_FRAC_BITS; } // Floors
+    explicit operator float() const { return (float)raw / FIX_ONE; }
+
+    friend constexpr fix16 operator+(fix16 a, fix16 b) { return saturate((int64_t)a.raw + b.raw); }
+    friend constexpr fix16 operator-(fix16 a, fix16 b) { return saturate((int64_t)a.raw - b.raw); }
+    friend constexpr fix16 operator*(fix16 a, fix16 b) { return saturate(((int64_t)a.raw * b.raw) >> FIX_FRAC_BITS); }
+    friend constexpr fix16 operator/(fix16 a, fix16 b) {
+        return b.raw == 0 ? from_raw(a.raw < 0 ? INT32_MIN : INT32_MAX) : saturate((int64_t)a.raw * FIX_ONE / b.raw);
+    }
+    constexpr fix16 operator-() const { return saturate(-(int64_t)raw); }
+
+    fix16 &operator+=(fix16 b) { return *this = *this + b; }
+    fix16 &operator-=(fix16 b) { return *this = *this - b; }
+    fix16 &operator*=(fix16 b) { return *this = *this * b; }
+    fix16 &operator/=(fix16 b) { return *this = *this / b; }
+
+    friend constexpr bool operator<(fix16 a, fix16 b) { return a.raw < b.raw; }
+    friend constexpr bool operator>(fix16 a, fix16 b) { return a.raw > b.raw; }
+    friend constexpr bool operator<=(fix16 a, fix16 b) { return a.raw <= b.raw; }
+    friend constexpr bool operator>=(fix16 a, fix16 b) { return a.raw >= b.raw; }
+    friend constexpr bool operator==(fix16 a, fix16 b) { return a.raw == b.raw; }
+    friend constexpr bool operator!=(fix16 a, fix16 b) { return a.raw != b.raw; }
+};
+
+typedef fix16 phys_t;
+
+#define PHYS_MAX fix16::from_raw(INT32_MAX)
+#define PHYS_MIN fix16::from_raw(INT32_MIN)
+
+static inline int phys_to_int(phys_t v) { return (int)v; }
+static inline int phys_round(phys_t v) { return (v + phys_t(0.5)).raw >> FIX_FRAC_BITS; }
+static inline int phys_ceil(phys_t v) { return (int)(((int64_t)v.raw + FIX_ONE - 1) >> FIX_FRAC_BITS); }
+static inline float phys_to_float(phys_t v) { return (float)v; }
+static inline phys_t phys_abs(phys_t v) { return v < 0 ? -v : v; }
+#else
+typedef float phys_t;
+
+#define PHYS_MAX INFINITY
+#define PHYS_MIN -INFINITY
+
+static inline int phys_to_int(phys_t v) { return (int)v; }
+static inline int phys_round(phys_t v) { return (int)floorf(v + 0.5f); }
+static inline int phys_ceil(phys_t v) { return (int)ceilf(v); }
+static inline float phys_to_float(phys_t v) { return v; }
+static inline phys_t phys_abs(phys_t v) { return fabsf(v); }
+#endif
+
+// Function declarations
+phys_t phys_sqrt(phys_t v);
+phys_t phys_sin_deg(int deg);
+phys_t phys_cos_deg(int deg);
+
+#endif
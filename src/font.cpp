@@ -0,0 +1,134 @@
+#include <Arduino.h>
+#include "font.h"
+#include "scroll.h"
+#include "display.h"
+#include "esp_log.h"
+
+// Opaque glyph renderer
+// Each glyph is kept as row masks, so a whole string is expanded one scanline
+// at a time. On the panel the string goes out as one address window and one
+// pixel stream, background included, so nothing needs clearing first. Other
+// GFX targets (strip canvas, framebuffer) get one span per run of equal colour.
+
+extern ScrollST7789 tft;
+
+// Row masks, bit 5 is the leftmost column
+static uint8_t glyph_rows[FONT_GLYPHS][FONT_CHAR_H];
+
+// Records the pixels the library font sets for one glyph
+class GlyphCanvas : public Adafruit_GFX {
+public:
+    GlyphCanvas() : Adafruit_GFX(FONT_CHAR_W, FONT_CHAR_H) {}
+    uint8_t rows[FONT_CHAR_H];
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+        if (x >= 0 && x < FONT_CHAR_W && y >= 0 && y < FONT_CHAR_H && color)
+            rows[y] |= 0x20 >> x;
+    }
+};
+
+// Expand the library's built-in font once, into row masks
+void font_init() {
+    GlyphCanvas canvas;
+
+    for (int i = 0; i < FONT_GLYPHS; i++) {
+        memset(canvas.rows, 0, sizeof(canvas.rows));
+        canvas.drawChar(0, 0, FONT_FIRST_CHAR + i, 1, 1, 1); // fg == bg draws only the glyph
+        memcpy(glyph_rows[i], canvas.rows, FONT_CHAR_H);
+    }
+
+    ESP_LOGI("DISPLAY", "FONT INIT (%d GLYPHS)", FONT_GLYPHS);
+}
+
+static const uint8_t *glyph(char c) {
+    if (c < FONT_FIRST_CHAR || c > FONT_LAST_CHAR)
+        c = '?';
+    return glyph_rows[c - FONT_FIRST_CHAR];
+}
+
+int font_text_width(const char *str, uint8_t size) {
+    return strlen(str) * FONT_CHAR_W * size;
+}
+
+// Expand glyph row gy of a string into line
+// Text is drawn from both the render task and the game loop, so the line lives on the caller's stack
+static void build_line(uint16_t *line, const char *str, int len, int gy, uint16_t color, uint16_t bg, uint8_t size) {
+    int i = 0;
+    for (int c = 0; c < len; c++) {
+        uint8_t bits = glyph(str[c])[gy];
+        for (int col = 0; col < FONT_CHAR_W; col++) {
+            uint16_t px = (bits & (0x20 >> col)) ? color : bg;
+            for (int s = 0; s < size; s++)
+                line[i++] = px;
+        }
+    }
+}
+
+// One window, one stream, remapped around the scrolled band
+static void blit_string(int x, int y, const char *str, int len, uint16_t color, uint16_t bg, uint8_t size) {
+    int w = len * FONT_CHAR_W * size;
+    int h = min(FONT_CHAR_H * size, SCREEN_HEIGHT - y);
+
+    uint16_t line[SCREEN_WIDTH];
+    scroll_run_t runs[SCROLL_MAX_RUNS];
+    int n = tft.mapRows(y, h, runs);
+
+    tft.startWrite();
+    for (int r = 0; r < n; r++) {
+        tft.setAddrWindow(x, runs[r].mem_y, w, runs[r].h);
+        int built = -1;
+        for (int sy = runs[r].y; sy < runs[r].y + runs[r].h; sy++) {
+            int gy = (sy - y) / size;
+            if (gy != built) {
+                build_line(line, str, len, gy, color, bg, size);
+                built = gy;
+            }
+            tft.writePixels(line, w);
+        }
+    }
+    tft.endWrite();
+}
+
+// Whether glyph column col of a string is set on row gy
+static bool text_bit(const char *str, int gy, int col) {
+    return glyph(str[col / FONT_CHAR_W])[gy] & (0x20 >> (col % FONT_CHAR_W));
+}
+
+// Spans of equal colour, for targets that are memory anyway
+// Runs are found on the glyph bits directly, no scanline needed
+static void span_string(Adafruit_GFX &g, int x, int y, const char *str, int len, uint16_t color, uint16_t bg, uint8_t size) {
+    int cols = len * FONT_CHAR_W;
+
+    for (int gy = 0; gy < FONT_CHAR_H; gy++) {
+        int run = 0;
+        bool run_set = text_bit(str, gy, 0);
+        for (int i = 1; i <= cols; i++) {
+            bool set = (i < cols) && text_bit(str, gy, i);
+            if (i == cols || set != run_set) {
+                g.fillRect(x + run * size, y + gy * size, (i - run) * size, size, run_set ? color : bg);
+                run = i;
+                run_set = set;
+            }
+        }
+    }
+}
+
+// Draw text with an opaque background, clipped to whole characters on screen
+void font_draw_string(Adafruit_GFX &g, int x, int y, const char *str, uint16_t color, uint16_t bg, uint8_t size) {
+    if (size < 1 || x < 0 || y < 0 || y >= SCREEN_HEIGHT)
+        return;
+
+    int len = min((int)strlen(str), (SCREEN_WIDTH - x) / (FONT_CHAR_W * size));
+    if (len <= 0)
+        return;
+
+    if (&g == (Adafruit_GFX *)&tft)
+        blit_string(x, y, str, len, color, bg, size);
+    else
+        span_string(g, x, y, str, len, color, bg, size);
+}
+
+void font_draw_char(Adafruit_GFX &g, int x, int y, char c, uint16_t color, uint16_t bg, uint8_t size) {
+    char str[2] = { c, '\0' };
+    font_draw_string(g, x, y, str, color, bg, size);
+}
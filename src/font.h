@@ -0,0 +1,19 @@
+#include "Adafruit_GFX.h"
+
+// Font constants, the classic 5x7 Adafruit_GFX font in a 6x8 cell
+#define FONT_CHAR_W 6
+#define FONT_CHAR_H 8
+#define FONT_FIRST_CHAR 0x20
+#define FONT_LAST_CHAR 0x7E
+#define FONT_GLYPHS (FONT_LAST_CHAR - FONT_FIRST_CHAR + 1)
+
+#ifndef FONT_H
+#define FONT_H
+
+// Function declarations
+void font_init();
+int font_text_width(const char *str, uint8_t size);
+void font_draw_string(Adafruit_GFX &g, int x, int y, const char *str, uint16_t color, uint16_t bg, uint8_t size);
+void font_draw_char(Adafruit_GFX &g, int x, int y, char c, uint16_t color, uint16_t bg, uint8_t size);
+
+#endif
@@ -0,0 +1,145 @@
+#include <Arduino.h>
+#include "frame.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+#include "beam.h"
+#include "ball.h"
+#include "powerups.h"
+
+// Fixed-timestep frame scheduler
+// Deadlines are kept in microseconds and converted to whole ticks for
+// vTaskDelayUntil, carrying the remainder, so a 16.667ms period averages out
+// exactly instead of drifting. An overrun resynchronises to now rather than
+// bursting frames to catch up.
+
+#define TICK_US (portTICK_PERIOD_MS * 1000)
+
+frame_sched_t frame_sched;
+
+frame_sched_t *get_frame_info() {
+    return &frame_sched;
+}
+
+static void reset_stats() {
+    frame_sched.frames = 0;
+    frame_sched.overruns = 0;
+    frame_sched.work_us = 0;
+    frame_sched.work_max_us = 0;
+    frame_sched.num_samples = 0;
+    frame_sched.sample_idx = 0;
+    memset(frame_sched.hist, 0, sizeof(frame_sched.hist));
+}
+
+static int bucket_of(uint32_t us) {
+    return min((int)(us / FRAME_HIST_BUCKET_US), FRAME_HIST_BUCKETS - 1);
+}
+
+// Add an interval to the rolling window, evicting the oldest once full
+static void record_interval(uint32_t us) {
+    uint16_t sample = min(us, (uint32_t)UINT16_MAX);
+
+    if (frame_sched.num_samples == FRAME_HIST_WINDOW)
+        frame_sched.hist[bucket_of(frame_sched.samples[frame_sched.sample_idx])]--;
+    else
+        frame_sched.num_samples++;
+
+    frame_sched.samples[frame_sched.sample_idx] = sample;
+    frame_sched.hist[bucket_of(sample)]++;
+    frame_sched.sample_idx = (frame_sched.sample_idx + 1) % FRAME_HIST_WINDOW;
+}
+
+void frame_set_rate(uint32_t rate_hz) {
+    frame_sched.rate_hz = rate_hz;
+    frame_sched.period_us = 1000000 / rate_hz;
+    frame_sched.frame_start_us = 0;
+    frame_sched.last_wake = xTaskGetTickCount();
+    frame_sched.deadline_us = esp_timer_get_time() + frame_sched.period_us;
+    reset_stats();
+
+    ESP_LOGI("FRAME", "FRAME RATE %u HZ (%u us)", (unsigned)rate_hz, (unsigned)frame_sched.period_us);
+}
+
+void frame_init(uint32_t rate_hz) {
+    frame_set_rate(rate_hz);
+}
+
+// Mark the start of a frame's work
+void frame_begin() {
+    int64_t now = esp_timer_get_time();
+    if (frame_sched.frame_start_us != 0)
+        record_interval(now - frame_sched.frame_start_us);
+    frame_sched.frame_start_us = now;
+}
+
+// Sleep until the end of the current frame period
+void frame_wait() {
+    int64_t now = esp_timer_get_time();
+    int64_t deadline = frame_sched.deadline_us;
+
+    frame_sched.frames++;
+    frame_sched.work_us = now - frame_sched.frame_start_us;
+    if (frame_sched.work_us > frame_sched.work_max_us)
+        frame_sched.work_max_us = frame_sched.work_us;
+
+    if (now >= deadline) {
+        // Missed it, start a fresh period from here
+        frame_sched.overruns++;
+        frame_sched.last_wake = xTaskGetTickCount();
+        frame_sched.deadline_us = now + frame_sched.period_us;
+        return;
+    }
+
+    // Advance by whole ticks, the sub-tick remainder stays in deadline_us
+    int64_t next = deadline + frame_sched.period_us;
+    TickType_t ticks = (next / TICK_US) - (deadline / TICK_US);
+    frame_sched.deadline_us = next;
+    vTaskDelayUntil(&frame_sched.last_wake, ticks);
+}
+
+// Print pacing stats and the interval histogram over serial
+void frame_dump_stats() {
+    uint64_t sum = 0;
+    uint16_t lo = UINT16_MAX, hi = 0;
+    for (int i = 0; i < frame_sched.num_samples; i++) {
+        sum += frame_sched.samples[i];
+        lo = min(lo, frame_sched.samples[i]);
+        hi = max(hi, frame_sched.samples[i]);
+    }
+
+    Serial.printf("FRAME STATS: %u Hz target, %u frames, %u overruns (%.1f%%)\n",
+        (unsigned)frame_sched.rate_hz, (unsigned)frame_sched.frames, (unsigned)frame_sched.overruns,
+        frame_sched.frames ? 100.0f * frame_sched.overruns / frame_sched.frames : 0.0f);
+    Serial.printf("WORK: last %u us, max %u us, budget %u us\n",
+        (unsigned)frame_sched.work_us, (unsigned)frame_sched.work_max_us, (unsigned)frame_sched.period_us);
+
+    ball_pool_t *pool = get_ball_pool();
+    Serial.printf("BALLS: %d live%s\n", pool->count, pool->stress ? " (stress mode)" : "");
+
+    powerup_stats_t *pstats = get_powerup_stats();
+    uint32_t prows = pstats->rows_written + pstats->rows_skipped;
+    Serial.printf("POWERUPS: %d falling, %u rows written, %u skipped (%.1f%%)\n",
+        get_powerup_state()->num_active, (unsigned)pstats->rows_written, (unsigned)pstats->rows_skipped,
+        prows ? 100.0f * pstats->rows_skipped / prows : 0.0f);
+
+    beam_state_t *beam = get_beam_info();
+    if (beam->frames > 0)
+        Serial.printf("BEAM WAIT: last %u us, avg %u us, max %u us (%u bad scanline reads)\n",
+            (unsigned)beam->last_wait_us, (unsigned)(beam->total_wait_us / beam->frames),
+            (unsigned)beam->max_wait_us, (unsigned)beam->bad_reads);
+
+    if (frame_sched.num_samples == 0)
+        return;
+
+    Serial.printf("INTERVAL (last %d): min %u us, avg %u us, max %u us\n",
+        frame_sched.num_samples, lo, (unsigned)(sum / frame_sched.num_samples), hi);
+
+    for (int b = 0; b < FRAME_HIST_BUCKETS; b++) {
+        if (frame_sched.hist[b] == 0)
+            continue;
+        int bar = (frame_sched.hist[b] * 40 + frame_sched.num_samples - 1) / frame_sched.num_samples;
+        Serial.printf("%2d%s ms | %4u ", b, (b == FRAME_HIST_BUCKETS - 1) ? "+" : " ", frame_sched.hist[b]);
+        for (int i = 0; i < bar; i++)
+            Serial.print('#');
+        Serial.println();
+    }
+}
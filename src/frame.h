@@ -0,0 +1,36 @@
+#include <Arduino.h>
+
+// Frame pacing constants
+#define DEFAULT_FRAME_RATE 60
+#define FRAME_HIST_BUCKETS 32        // Last bucket also counts everything slower
+#define FRAME_HIST_BUCKET_US 1000    // 1ms per bucket
+#define FRAME_HIST_WINDOW 512        // Frames kept in the rolling histogram
+
+#ifndef FRAME_H
+#define FRAME_H
+
+typedef struct {
+    uint32_t rate_hz;
+    uint32_t period_us;
+    int64_t deadline_us;        // When the current frame should end
+    int64_t frame_start_us;
+    TickType_t last_wake;
+    uint32_t frames;
+    uint32_t overruns;          // Frames whose work ran past the deadline
+    uint32_t work_us;           // Work time of the last frame
+    uint32_t work_max_us;
+    uint16_t samples[FRAME_HIST_WINDOW]; // Start-to-start intervals, in us
+    uint16_t hist[FRAME_HIST_BUCKETS];
+    int num_samples;
+    int sample_idx;
+} frame_sched_t;
+
+// Function declarations
+frame_sched_t *get_frame_info();
+void frame_init(uint32_t rate_hz = DEFAULT_FRAME_RATE);
+void frame_set_rate(uint32_t rate_hz);
+void frame_begin();
+void frame_wait();
+void frame_dump_stats();
+
+#endif
@@ -0,0 +1,251 @@
+#include <Arduino.h>
+#include "Adafruit_ST7789.h"
+#include "framebuffer.h"
+#include "display.h"
+#include "strip.h"
+#include "esp_log.h"
+
+// Palette-indexed framebuffer
+// 240x320 at 4bpp is 38.4KB of DRAM, so it is only allocated while a screen
+// that needs it (the pause menu) is up, and drawing into it is a no-op
+// otherwise. Drawing is nibble writes in RAM, and the flush expands only the
+// rows that changed to RGB565 through the strip renderer. A palette change
+// (dimming the scene behind the pause menu) costs a flush, not a redraw.
+
+#define FB_STRIDE (SCREEN_WIDTH / 2)
+#define FB_DIRTY_WORDS ((SCREEN_HEIGHT + 31) / 32)
+
+#define FB_BYTES (FB_STRIDE * SCREEN_HEIGHT)
+
+static uint8_t *fb_pixels = NULL;
+static uint32_t fb_dirty_rows[FB_DIRTY_WORDS];
+
+// Colours the scene is drawn with, and what is actually sent to the panel
+static uint16_t base_palette[FB_PALETTE_SIZE] = {
+    // Scene
+    (uint16_t)~ST77XX_BLACK, (uint16_t)~ST77XX_WHITE, (uint16_t)~ST77XX_RED, (uint16_t)~ST77XX_ORANGE,
+    (uint16_t)~ST77XX_GREEN, (uint16_t)~ST77XX_BLUE, (uint16_t)~ST77XX_CYAN, (uint16_t)~ST77XX_YELLOW,
+    (uint16_t)~0x5A5A, (uint16_t)~ST77XX_MAGENTA,
+    // Overlay
+    (uint16_t)~ST77XX_BLACK, (uint16_t)~ST77XX_WHITE, (uint16_t)~ST77XX_BLUE, (uint16_t)~ST77XX_RED,
+    (uint16_t)~ST77XX_GREEN, (uint16_t)~ST77XX_YELLOW
+};
+static uint16_t out_palette[FB_PALETTE_SIZE];
+
+FbCanvas framebuffer;
+
+// Claim the pixel memory, false if the heap can't spare it
+bool fb_alloc() {
+    if (fb_pixels != NULL)
+        return true;
+
+    fb_pixels = (uint8_t *)malloc(FB_BYTES);
+    if (fb_pixels == NULL) {
+        ESP_LOGE("DISPLAY", "FRAMEBUFFER ALLOC FAILED (%u BYTES, %u FREE)", (unsigned)FB_BYTES, (unsigned)ESP.getFreeHeap());
+        return false;
+    }
+    memset(fb_dirty_rows, 0, sizeof(fb_dirty_rows));
+    return true;
+}
+
+// Give the pixel memory back, the palette goes back to full brightness
+void fb_free() {
+    free(fb_pixels);
+    fb_pixels = NULL;
+    memset(fb_dirty_rows, 0, sizeof(fb_dirty_rows));
+    memcpy(out_palette, base_palette, sizeof(out_palette));
+}
+
+bool fb_ready() {
+    return fb_pixels != NULL;
+}
+
+FbCanvas &get_framebuffer() {
+    return framebuffer;
+}
+
+uint8_t *get_framebuffer_row(int y) {
+    return &fb_pixels[y * FB_STRIDE];
+}
+
+// --- DIRTY ROWS ---
+void fb_mark_rows(int y, int h) {
+    int y0 = max(y, 0);
+    int y1 = min(y + h, SCREEN_HEIGHT);
+    for (int r = y0; r < y1; r++)
+        fb_dirty_rows[r >> 5] |= 1u << (r & 31);
+}
+
+void fb_mark_all() {
+    fb_mark_rows(0, SCREEN_HEIGHT);
+}
+
+static bool row_dirty(int y) {
+    return fb_dirty_rows[y >> 5] & (1u << (y & 31));
+}
+
+// --- CANVAS ---
+FbCanvas::FbCanvas() : Adafruit_GFX(SCREEN_WIDTH, SCREEN_HEIGHT), cur_layer(FB_LAYER_SCENE), last_color(0), last_index(FB_SCENE_BASE) {
+    memcpy(out_palette, base_palette, sizeof(out_palette));
+    last_color = base_palette[FB_SCENE_BASE];
+}
+
+void FbCanvas::setLayer(fb_layer layer) {
+    cur_layer = layer;
+    last_index = (layer == FB_LAYER_SCENE) ? FB_SCENE_BASE : FB_OVERLAY_BASE;
+    last_color = base_palette[last_index];
+}
+
+// Map an RGB565 colour to an entry of the current layer
+// Unknown colours fall back to the first entry (black)
+uint8_t FbCanvas::colorIndex(uint16_t color) {
+    if (color == last_color)
+        return last_index;
+
+    int base = (cur_layer == FB_LAYER_SCENE) ? FB_SCENE_BASE : FB_OVERLAY_BASE;
+    int count = (cur_layer == FB_LAYER_SCENE) ? FB_SCENE_COLORS : FB_OVERLAY_COLORS;
+    uint8_t index = base;
+    for (int i = base; i < base + count; i++) {
+        if (base_palette[i] == color) {
+            index = i;
+            break;
+        }
+    }
+
+    last_color = color;
+    last_index = index;
+    return index;
+}
+
+static inline void put_nibble(uint8_t *row, int x, uint8_t index) {
+    uint8_t *p = &row[x >> 1];
+    if (x & 1)
+        *p = (*p & 0xF0) | index;
+    else
+        *p = (*p & 0x0F) | (index << 4);
+}
+
+void FbCanvas::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if (fb_pixels == NULL || x < 0 || y < 0 || x >= SCREEN_WIDTH || y >= SCREEN_HEIGHT)
+        return;
+    put_nibble(get_framebuffer_row(y), x, colorIndex(color));
+    fb_dirty_rows[y >> 5] |= 1u << (y & 31);
+}
+
+void FbCanvas::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    int x0 = max((int)x, 0);
+    int y0 = max((int)y, 0);
+    int x1 = min((int)x + w, SCREEN_WIDTH);
+    int y1 = min((int)y + h, SCREEN_HEIGHT);
+    if (fb_pixels == NULL || x1 <= x0 || y1 <= y0)
+        return;
+
+    uint8_t index = colorIndex(color);
+    uint8_t both = (index << 4) | index;
+
+    for (int r = y0; r < y1; r++) {
+        uint8_t *row = get_framebuffer_row(r);
+        int cx = x0;
+        // Leading odd pixel, whole bytes, trailing even pixel
+        if (cx & 1)
+            put_nibble(row, cx++, index);
+        int bytes = (x1 - cx) >> 1;
+        memset(&row[cx >> 1], both, bytes);
+        cx += bytes << 1;
+        if (cx < x1)
+            put_nibble(row, cx, index);
+    }
+    fb_mark_rows(y0, y1 - y0);
+}
+
+void FbCanvas::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    fillRect(x, y, w, 1, color);
+}
+
+void FbCanvas::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    fillRect(x, y, 1, h, color);
+}
+
+void FbCanvas::fillScreen(uint16_t color) {
+    fillRect(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, color);
+}
+
+// --- PALETTE ---
+void fb_set_palette(int index, uint16_t color) {
+    if (index < 0 || index >= FB_PALETTE_SIZE)
+        return;
+    base_palette[index] = color;
+    out_palette[index] = color;
+    fb_mark_all();
+}
+
+// Colours are stored inverted for the panel, dim the colour that is shown
+static uint16_t dim_color(uint16_t color, int shift) {
+    uint16_t shown = ~color;
+    uint16_t r = ((shown >> 11) & 0x1F) >> shift;
+    uint16_t g = ((shown >> 5) & 0x3F) >> shift;
+    uint16_t b = (shown & 0x1F) >> shift;
+    return ~((r << 11) | (g << 5) | b);
+}
+
+// Darken the scene entries, overlay entries stay at full brightness
+void fb_dim_scene(int shift) {
+    for (int i = FB_SCENE_BASE; i < FB_SCENE_BASE + FB_SCENE_COLORS; i++)
+        out_palette[i] = dim_color(base_palette[i], shift);
+    fb_mark_all();
+}
+
+// --- FLUSH ---
+// Expand a band of indexed rows to RGB565 straight into the strip buffer
+static void expand_rows(Adafruit_GFX &g, int x, int y, int w, int h) {
+    uint16_t *out = static_cast<StripCanvas &>(g).getBuffer();
+    for (int r = y; r < y + h; r++) {
+        const uint8_t *row = get_framebuffer_row(r);
+        if (x == 0 && w == SCREEN_WIDTH) {
+            // Whole rows, two pixels per byte
+            for (int i = 0; i < FB_STRIDE; i++) {
+                uint8_t pair = row[i];
+                *out++ = out_palette[pair >> 4];
+                *out++ = out_palette[pair & 0x0F];
+            }
+        } else {
+            for (int c = x; c < x + w; c++) {
+                uint8_t pair = row[c >> 1];
+                *out++ = out_palette[(c & 1) ? (pair & 0x0F) : (pair >> 4)];
+            }
+        }
+    }
+}
+
+// Push one rectangle of the framebuffer regardless of the row marks
+// Rows stay marked, other columns of them may still be pending
+uint32_t fb_flush_rect(int x, int y, int w, int h) {
+    if (fb_pixels == NULL)
+        return 0;
+    strip_render(x, y, w, h, expand_rows, out_palette[FB_SCENE_BASE]);
+    return w * h;
+}
+
+// Push every run of changed rows, returns the number of pixels pushed
+uint32_t fb_flush() {
+    uint32_t pixels = 0;
+    if (fb_pixels == NULL)
+        return 0;
+
+    int y = 0;
+    while (y < SCREEN_HEIGHT) {
+        if (!row_dirty(y)) {
+            y++;
+            continue;
+        }
+        int start = y;
+        while (y < SCREEN_HEIGHT && row_dirty(y))
+            y++;
+
+        strip_render(0, start, SCREEN_WIDTH, y - start, expand_rows, out_palette[FB_SCENE_BASE]);
+        pixels += SCREEN_WIDTH * (y - start);
+    }
+
+    memset(fb_dirty_rows, 0, sizeof(fb_dirty_rows));
+    return pixels;
+}
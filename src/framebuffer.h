@@ -0,0 +1,55 @@
+#include "Adafruit_GFX.h"
+
+// Framebuffer constants
+#define FB_BPP 4
+#define FB_PALETTE_SIZE 16
+#define FB_SCENE_BASE 0       // Palette entries 0-9 hold scene colours
+#define FB_SCENE_COLORS 10
+#define FB_OVERLAY_BASE 10    // Palette entries 10-15 hold overlay (menu) colours
+#define FB_OVERLAY_COLORS 6
+#define FB_PAUSE_DIM 2        // Scene brightness shift while paused (1/4)
+
+#ifndef FRAMEBUFFER_H
+#define FRAMEBUFFER_H
+
+enum fb_layer {
+    FB_LAYER_SCENE,
+    FB_LAYER_OVERLAY
+};
+
+// 4bpp palette-indexed framebuffer
+// Drawing calls take RGB565 colours like any other GFX target, the colour is
+// mapped to a palette index of the current layer. Rows written since the last
+// flush are tracked so only they get expanded and pushed.
+class FbCanvas : public Adafruit_GFX {
+public:
+    FbCanvas();
+    void setLayer(fb_layer layer);
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+    void fillScreen(uint16_t color) override;
+
+private:
+    uint8_t colorIndex(uint16_t color);
+    fb_layer cur_layer;
+    uint16_t last_color;
+    uint8_t last_index;
+};
+
+// Function declarations
+bool fb_alloc();
+void fb_free();
+bool fb_ready();
+FbCanvas &get_framebuffer();
+uint8_t *get_framebuffer_row(int y);
+void fb_mark_rows(int y, int h);
+void fb_mark_all();
+void fb_set_palette(int index, uint16_t color);
+void fb_dim_scene(int shift);
+uint32_t fb_flush();
+uint32_t fb_flush_rect(int x, int y, int w, int h);
+
+#endif
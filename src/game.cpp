@@ -2,12 +2,17 @@
 #include <cmath>
 #include "game.h"
 #include "display.h"
+#include "profile.h"
 #include "paddle.h"
 #include "ball.h"
 #include "inputs.h"
 #include "util.h"
 #include "debug.h"
 #include "system.h"
+#include "dirty.h"
+#include "hud.h"
+#include "grid.h"
+#include "powerups.h"
 
 // GLOBALS
 game_t game = {
@@ -17,7 +22,6 @@ game_t game = {
     .points = 0,
     .lives = STARTER_LIVES,
     .max_score = 0,
-    .redraw_header = false,
     .last_interval = 0,
     .interval = DEFAULT_INTERVAL,
     .min_interval = MIN_INTERVAL,
@@ -45,9 +49,16 @@ void load_level(int levelIndex, bool use_load_screen) {
     int spacing = game.current_level.brickSpacing;
     game.current_level.brickOffsetX = (SCREEN_WIDTH - (numCols * (width + spacing)))/2;
     game.current_level.brickOffsetY = HEADER_HEIGHT + TOP_BUFFER;
+    grid_rebuild(&game.current_level);
+    board_load(&game.current_level);
 }
 
 void resetGame(bool use_load_screen) {
+    // Falling powerups go with the level, what's under them is put back unless the screen is cleared
+    if (!use_load_screen)
+        erase_powerups();
+    clear_powerups();
+
     if (use_load_screen)
         black_screen();
     draw_header();
@@ -55,19 +66,13 @@ void resetGame(bool use_load_screen) {
     paddle_t *p_info = get_paddle_info();
     p_info->paddle_x = (SCREEN_WIDTH - p_info->paddle_width)/2;
 
+    // Back to a single ball waiting on the paddle
     ball_t *b_info = get_ball_info();
-    b_info->x = (p_info->paddle_y + p_info->paddle_width)/2;
-    b_info->y = p_info->paddle_y - p_info->paddle_height - b_info->radius - 1;
-    b_info->ball_on_paddle = true;
-    b_info->launch_angle = getRandomInt(30, 150);
-
-    // Increment speed
-    b_info->speed = min(b_info->speed + 0.15, MAX_SPEED);
-
-    // Normalize direction and apply new speed
-    float norm = sqrt(b_info->dx * b_info->dx + b_info->dy * b_info->dy);
-    b_info->dx = (b_info->dx / norm) * b_info->speed;
-    b_info->dy = (b_info->dy / norm) * b_info->speed;
+    reset_balls();
+    b_info->launch_angle = random_launch_angle();
+
+    // Increment speed, the next launch picks it up
+    b_info->speed = min(b_info->speed + phys_t(0.15), phys_t(MAX_SPEED));
     p_info->paddle_speed = PADDLE_SPEED_DAMPEN(b_info->speed); 
 
     // Reset brick movement interval
@@ -80,6 +85,9 @@ void resetGame(bool use_load_screen) {
     draw_all_bricks();
 
     draw_loss_boundary();
+
+    // Screen was fully redrawn, nothing left to repair
+    dirty_clear();
 }
 
 
@@ -109,29 +117,15 @@ void next_level(bool use_load_screen) {
 
 
 bool check_game_finished() {
-    for (int r = 0; r < game.current_level.brickRows; r++) {
-        for (int c = 0; c < game.current_level.brickCols; c++) {
-            if (game.current_level.bricks[r][c] > 0)
-                return false;
-        }
-    }
-    return true;
+    return board_empty();
 }
 
+// Y of the lowest row that still has a brick, -1 when the field is clear
 int getLowestActiveBrickY() {
-    // Iterate through rows from the bottom upwards
-    for (int r = game.current_level.brickRows - 1; r >= 0; r--) {
-        // Check if any brick in this row is active
-        for (int c = 0; c < game.current_level.brickCols; c++) {
-            if (game.current_level.bricks[r][c] > 0) {
-                // Calculate the y level for this row
-                int by = game.current_level.brickOffsetY + r * (game.current_level.brickHeight + game.current_level.brickSpacing);
-                return by; // Return the y level of the lowest active row
-            }
-        }
-    }
-    // If no active bricks are found, return -1 (or any invalid value)
-    return -1;
+    int r = board_lowest_row();
+    if (r < 0)
+        return -1;
+    return game.current_level.brickOffsetY + r * (game.current_level.brickHeight + game.current_level.brickSpacing);
 }
 
 void start_game() {
@@ -186,7 +180,7 @@ void end_game_and_restart(bool is_ai_game) {
 
 void handle_pause_input(int selected_option) {
     switch (selected_option) {
-        case 0: { // Brightness adjustment
+        case PAUSE_OPT_BRIGHTNESS: { // Brightness adjustment
             static int brightness_level = 3; // 0 = Low, 1 = Medium, 2 = High
             int brightness_values[] = { 25, 50, 150, 255 }; // Define brightness levels
             
@@ -194,22 +188,27 @@ void handle_pause_input(int selected_option) {
             set_brightness(brightness_values[brightness_level]);
             break;
         }
-        case 1: { // Toggle LED brightness
+        case PAUSE_OPT_LED: { // Toggle LED brightness
             static int led_level = 3; // 0 = off, 1 = dim, 2 = full
             led_level = (led_level + 1) % 4;
             led_brightness(led_level);
             break;
         }
-        case 2: // Reset game
+        case PAUSE_OPT_PROFILE: // Cycle performance profile
+            profile_next();
+            redraw_pause_option(PAUSE_OPT_PROFILE);
+            break;
+        case PAUSE_OPT_RESET: // Reset game
             end_game_and_restart(true);
             break;
-        case 3: // Restart ESP32
+        case PAUSE_OPT_RESTART: // Restart ESP32
             ESP.restart();
             break;
     }
 }
 
 void pause_menu_logic() {
+    draw_pause_background();
     drawpausescreen(0);
     int selected_opt = 0;
     int cycles = 0;
@@ -218,18 +217,20 @@ void pause_menu_logic() {
 
         if (get_up_pressed()) {
             if (--selected_opt < 0) {
-                selected_opt = 3;
+                selected_opt = PAUSE_OPTIONS - 1;
             }
-            drawpausescreen(selected_opt);
+            draw_pause_selection(selected_opt);
         } else if (get_down_pressed()) {
             selected_opt++;
-            selected_opt %= 4;
-            drawpausescreen(selected_opt);
+            selected_opt %= PAUSE_OPTIONS;
+            draw_pause_selection(selected_opt);
         }  else if (get_a_pressed()) {
             handle_pause_input(selected_opt);
 
-            if (selected_opt > 1)
+            if (selected_opt >= PAUSE_OPT_RESET) {
+                release_pause_background(); // The reset redrew the screen
                 return;
+            }
         }
 
         if (cycles > BATTERY_CHECK_INTERVAL) {
@@ -239,10 +240,7 @@ void pause_menu_logic() {
 
         delay(1);
     }
-    black_screen();
-    draw_all_bricks();
-    draw_header();
-    draw_loss_boundary();
+    restore_pause_background();
 }
 
 
@@ -268,8 +266,7 @@ void game_cycle() {
             movePaddleDraw(p_info->paddle_speed);
         }
         
-        draw_paddle();
-        handle_collision(); // Paddle-ball collision
+        draw_paddle(); // Ball-paddle contact is part of the ball's sweep
     } else { 
         draw_paddle();
     }
@@ -316,23 +313,19 @@ void game_cycle() {
             }   
         }
         
-        float old_x = b_info->x;
-        float old_y = b_info->y;
-
         ball_collision();
 
-        // Draw lose boundary
-        draw_loss_boundary();
+        // Powerups fall before the balls are drawn, so balls vacating one find it binned
+        update_powerups();
 
-        // Draw ball in new location, erase in old location
-        draw_ball(b_info->x, b_info->y, old_x, old_y, b_info->radius);
+        // Draw balls in their new locations, erase what is left of the old ones
+        draw_balls();
 
-        draw_all_bricks();
-        
-        if (game.redraw_header) {
-            draw_header();
-            game.redraw_header = false;
-        }
+        // Repaint scenery (bricks, header, lose boundary) under everything erased this frame
+        dirty_flush();
+
+        // Score and lives changed during physics are written once, digit by digit
+        hud_update();
 
         if (game.game_finished) {
             next_level(true);
@@ -16,7 +16,6 @@ typedef struct {
     int points;
     int lives;
     int max_score;
-    bool redraw_header;
     unsigned long last_interval;
     float interval;
     const float min_interval;
@@ -0,0 +1,140 @@
+#include <Arduino.h>
+#include "grid.h"
+#include "game.h"
+
+// Brick broadphase and board
+// Bricks sit on a uniform grid, so a box on screen maps to a range of cells
+// with two divisions per axis, whatever the size of the grid. Collision code
+// walks only those cells and reads brick edges from the rect table instead of
+// recomputing them from the level offsets. The table only changes when a
+// level loads or the field moves down.
+
+static brick_grid_t grid;
+
+brick_grid_t *get_brick_grid() {
+    return &grid;
+}
+
+const brick_rect_t *grid_rect(int r, int c) {
+    return &grid.rects[r][c];
+}
+
+// Recompute every cell from the level layout
+void grid_rebuild(const LevelInfo *level) {
+    grid.rows = min(level->brickRows, MAX_BRICK_ROWS);
+    grid.cols = min(level->brickCols, MAX_BRICK_COLS);
+    grid.origin_x = level->brickOffsetX;
+    grid.origin_y = level->brickOffsetY;
+    grid.pitch_x = level->brickWidth + level->brickSpacing;
+    grid.pitch_y = level->brickHeight + level->brickSpacing;
+
+    for (int r = 0; r < grid.rows; r++) {
+        for (int c = 0; c < grid.cols; c++) {
+            brick_rect_t *rect = &grid.rects[r][c];
+            rect->left = grid.origin_x + c * grid.pitch_x;
+            rect->top = grid.origin_y + r * grid.pitch_y;
+            rect->right = rect->left + level->brickWidth;
+            rect->bottom = rect->top + level->brickHeight;
+        }
+    }
+}
+
+// Cell index along one axis, floored so boxes left of / above the grid go negative
+static int cell_of(int pos, int origin, int pitch) {
+    int d = pos - origin;
+    return d >= 0 ? d / pitch : -((-d + pitch - 1) / pitch);
+}
+
+// Cells whose pitch overlaps [left, right] x [top, bottom], clipped to the grid
+cell_range_t grid_cells_in(int left, int top, int right, int bottom) {
+    cell_range_t range = { 0, -1, 0, -1 };
+    if (grid.pitch_x <= 0 || grid.pitch_y <= 0)
+        return range; // No level loaded yet
+
+    range.c0 = max(cell_of(left, grid.origin_x, grid.pitch_x), 0);
+    range.c1 = min(cell_of(right, grid.origin_x, grid.pitch_x), grid.cols - 1);
+    range.r0 = max(cell_of(top, grid.origin_y, grid.pitch_y), 0);
+    range.r1 = min(cell_of(bottom, grid.origin_y, grid.pitch_y), grid.rows - 1);
+    return range;
+}
+
+// --- BOARD ---
+// Brick state lives in 64-bit masks rather than the level's int array, so the
+// questions asked every frame (any bricks left, lowest live row, which bricks
+// of a row are up) are a compare, a bit-scan or a shift. Collision, game logic
+// and the renderer all read this board.
+
+static brick_board_t board;
+
+brick_board_t *get_brick_board() {
+    return &board;
+}
+
+static inline int bit_of(int r, int c) {
+    return r * MAX_BRICK_COLS + c;
+}
+
+// Build the board from a freshly loaded level
+void board_load(const LevelInfo *level) {
+    memset(&board, 0, sizeof(board));
+
+    int rows = min(level->brickRows, MAX_BRICK_ROWS);
+    int cols = min(level->brickCols, MAX_BRICK_COLS);
+    for (int r = 0; r < rows; r++) {
+        for (int c = 0; c < cols; c++) {
+            int d = constrain(level->bricks[r][c], 0, BRICK_MAX_DURABILITY);
+            if (d == 0)
+                continue;
+
+            uint64_t bit = 1ULL << bit_of(r, c);
+            board.live |= bit;
+            for (int k = 0; k < BRICK_PLANES; k++) {
+                if (d & (1 << k))
+                    board.planes[k] |= bit;
+            }
+        }
+    }
+}
+
+int board_durability(const brick_board_t *b, int r, int c) {
+    int n = bit_of(r, c);
+    int d = 0;
+    for (int k = 0; k < BRICK_PLANES; k++)
+        d |= ((b->planes[k] >> n) & 1) << k;
+    return d;
+}
+
+// Take one durability off a live brick, returns what is left
+int board_hit(int r, int c) {
+    uint64_t bit = 1ULL << bit_of(r, c);
+    if (!(board.live & bit))
+        return 0;
+
+    // Ripple-borrow subtract one down the planes
+    for (int k = 0; k < BRICK_PLANES; k++) {
+        bool was_set = board.planes[k] & bit;
+        board.planes[k] ^= bit;
+        if (was_set)
+            break;
+    }
+
+    int d = board_durability(&board, r, c);
+    if (d == 0)
+        board.live &= ~bit;
+    return d;
+}
+
+bool board_empty() {
+    return board.live == 0;
+}
+
+// Lowest row with a live brick, -1 when the board is empty
+int board_lowest_row() {
+    if (board.live == 0)
+        return -1;
+    return (63 - __builtin_clzll(board.live)) / MAX_BRICK_COLS;
+}
+
+uint8_t board_row_live(const brick_board_t *b, int r) {
+    return (b->live >> (r * MAX_BRICK_COLS)) & BRICK_ROW_MASK;
+}
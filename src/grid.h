@@ -0,0 +1,56 @@
+#include <Arduino.h>
+
+// Largest brick field a level can have
+#define MAX_BRICK_ROWS 6
+#define MAX_BRICK_COLS 8
+
+// Durability bits per brick, enough for the 0..3 the levels use
+#define BRICK_PLANES 2
+#define BRICK_MAX_DURABILITY ((1 << BRICK_PLANES) - 1)
+#define BRICK_ROW_MASK ((1ULL << MAX_BRICK_COLS) - 1)
+
+#ifndef GRID_H
+#define GRID_H
+
+struct LevelInfo;
+
+// Screen rect of one brick cell, edges exclusive on the right and bottom
+typedef struct {
+    int16_t left, top, right, bottom;
+} brick_rect_t;
+
+// Brick geometry, cached between level loads and field moves
+typedef struct {
+    int rows, cols;
+    int origin_x, origin_y;     // Top left of cell (0, 0)
+    int pitch_x, pitch_y;       // Brick plus spacing
+    brick_rect_t rects[MAX_BRICK_ROWS][MAX_BRICK_COLS];
+} brick_grid_t;
+
+// Cells [r0, r1] x [c0, c1], empty when r0 > r1 or c0 > c1
+typedef struct {
+    int r0, r1, c0, c1;
+} cell_range_t;
+
+// Live brick state, brick (r, c) is bit r * MAX_BRICK_COLS + c of every mask
+// Durability is spread over bit-planes, plane k holds bit k of each brick's count
+typedef struct {
+    uint64_t live;
+    uint64_t planes[BRICK_PLANES];
+} brick_board_t;
+
+// Function declarations
+brick_grid_t *get_brick_grid();
+void grid_rebuild(const LevelInfo *level);
+cell_range_t grid_cells_in(int left, int top, int right, int bottom);
+const brick_rect_t *grid_rect(int r, int c);
+
+brick_board_t *get_brick_board();
+void board_load(const LevelInfo *level);
+int board_durability(const brick_board_t *board, int r, int c);
+int board_hit(int r, int c);
+bool board_empty();
+int board_lowest_row();
+uint8_t board_row_live(const brick_board_t *board, int r);
+
+#endif
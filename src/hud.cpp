@@ -0,0 +1,117 @@
+#include <Arduino.h>
+#include "hud.h"
+#include "display.h"
+#include "game.h"
+#include "render.h"
+
+// Incremental HUD
+// Remembers what the header shows and, once per frame, rewrites only the
+// digit cells and life circles whose value changed. Digits are drawn as
+// opaque glyph cells so nothing has to be cleared first. Per-frame updates
+// are queued to the render task.
+
+hud_state_t hud = {
+    .valid = false,
+    .level = 0,
+    .points = 0,
+    .lives = 0,
+    .level_str = "",
+    .points_str = ""
+};
+
+hud_state_t *get_hud_info() {
+    return &hud;
+}
+
+// Draw life circle i, filled if still available
+void hud_draw_life(Adafruit_GFX &g, int i, int lives) {
+    int x = HUD_LIVES_X + i * HUD_LIFE_SPACING;
+    int y = HUD_LIVES_Y + HUD_LIFE_RADIUS;
+
+    if (i < lives) {
+        if (i < STARTER_LIVES)
+            g.fillCircle(x, y, HUD_LIFE_RADIUS, ~ST77XX_WHITE); // Filled for active life
+        else
+            g.fillCircle(x, y, HUD_LIFE_RADIUS, ~ST77XX_GREEN); // Filled for active life
+    } else if (i < STARTER_LIVES) {
+        g.drawCircle(x, y, HUD_LIFE_RADIUS, ~0x5A5A); // Outline for lost life
+    }
+}
+
+// Repaint one life cell through the render queue, same look as hud_draw_life
+static void queue_life(int i, int lives) {
+    int x = HUD_LIVES_X + i * HUD_LIFE_SPACING;
+    int y = HUD_LIVES_Y + HUD_LIFE_RADIUS;
+
+    render_fill_rect(x - HUD_LIFE_RADIUS, HUD_LIVES_Y, 2 * HUD_LIFE_RADIUS + 1, 2 * HUD_LIFE_RADIUS + 1, ~ST77XX_BLUE);
+    if (i < lives)
+        render_fill_circle(x, y, HUD_LIFE_RADIUS, (i < STARTER_LIVES) ? ~ST77XX_WHITE : ~ST77XX_GREEN);
+    else if (i < STARTER_LIVES)
+        render_draw_circle(x, y, HUD_LIFE_RADIUS, ~0x5A5A);
+}
+
+// Record the current values after the whole header was drawn
+void hud_sync() {
+    game_t *g_info = get_game_info();
+    hud.level = g_info->current_level_index + 1;
+    hud.points = g_info->points;
+    hud.lives = g_info->lives;
+    snprintf(hud.level_str, sizeof(hud.level_str), "%d", hud.level);
+    snprintf(hud.points_str, sizeof(hud.points_str), "%d", hud.points);
+    hud.valid = true;
+}
+
+void hud_invalidate() {
+    hud.valid = false;
+}
+
+// Rewrite the glyph cells that differ between two numbers
+static void update_digits(int x, const char *old_str, const char *new_str) {
+    int old_len = strlen(old_str);
+    int new_len = strlen(new_str);
+
+    for (int i = 0; i < new_len; i++) {
+        if (i >= old_len || old_str[i] != new_str[i])
+            render_char(x + i * HUD_CHAR_W, HUD_TEXT_Y, new_str[i], ~ST77XX_WHITE, ~ST77XX_BLUE, 1);
+    }
+
+    // Number got shorter
+    if (old_len > new_len)
+        render_fill_rect(x + new_len * HUD_CHAR_W, HUD_TEXT_Y, (old_len - new_len) * HUD_CHAR_W, HUD_CHAR_H, ~ST77XX_BLUE);
+}
+
+// Called once per frame, after physics
+void hud_update() {
+    game_t *g_info = get_game_info();
+
+    if (!hud.valid) {
+        draw_header();
+        return;
+    }
+
+    int level = g_info->current_level_index + 1;
+    if (level != hud.level) {
+        char level_str[HUD_FIELD_LEN];
+        snprintf(level_str, sizeof(level_str), "%d", level);
+        update_digits(HUD_LEVEL_X + strlen("Level: ") * HUD_CHAR_W, hud.level_str, level_str);
+        strcpy(hud.level_str, level_str);
+        hud.level = level;
+    }
+
+    if (g_info->points != hud.points) {
+        char points_str[HUD_FIELD_LEN];
+        snprintf(points_str, sizeof(points_str), "%d", g_info->points);
+        update_digits(HUD_POINTS_X + strlen("Points: ") * HUD_CHAR_W, hud.points_str, points_str);
+        strcpy(hud.points_str, points_str);
+        hud.points = g_info->points;
+    }
+
+    if (g_info->lives != hud.lives) {
+        int lo = min(g_info->lives, hud.lives);
+        int hi = min(max(g_info->lives, hud.lives), MAX_LIVES);
+        for (int i = lo; i < hi; i++) {
+            queue_life(i, g_info->lives);
+        }
+        hud.lives = g_info->lives;
+    }
+}
@@ -0,0 +1,36 @@
+#include "Adafruit_GFX.h"
+
+// HUD layout, all inside the header bar
+#define HUD_TEXT_Y 5
+#define HUD_LEVEL_X 5
+#define HUD_POINTS_X 80
+#define HUD_LIVES_X 180
+#define HUD_LIVES_Y 4
+#define HUD_LIFE_RADIUS 3
+#define HUD_LIFE_SPACING 10
+#define HUD_CHAR_W 6
+#define HUD_CHAR_H 8
+#define HUD_FIELD_LEN 12
+
+#ifndef HUD_H
+#define HUD_H
+
+// Structs
+// Values as they are currently shown in the header
+typedef struct {
+    bool valid;
+    int level;
+    int points;
+    int lives;
+    char level_str[HUD_FIELD_LEN];
+    char points_str[HUD_FIELD_LEN];
+} hud_state_t;
+
+// Function declarations
+hud_state_t *get_hud_info();
+void hud_draw_life(Adafruit_GFX &g, int i, int lives);
+void hud_sync();
+void hud_invalidate();
+void hud_update();
+
+#endif
@@ -1,4 +1,5 @@
 #include <Arduino.h>
+#include "grid.h"
 
 struct LevelInfo {
     int brickRows;
@@ -8,7 +9,7 @@ struct LevelInfo {
     int brickSpacing;
     int brickOffsetX;
     int brickOffsetY;
-    int bricks[6][8];
+    int bricks[MAX_BRICK_ROWS][MAX_BRICK_COLS]; // Starting durabilities, play runs on the brick board
 };
 
 const LevelInfo levels[] PROGMEM = {
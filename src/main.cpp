@@ -5,6 +5,10 @@
 #include "inputs.h"
 #include "util.h"
 #include "system.h"
+#include "render.h"
+#include "frame.h"
+#include "ball.h"
+#include "profile.h"
 
 void setup() {
     
@@ -19,18 +23,39 @@ void setup() {
     Serial.println("INPUT INIT");
     debug_delay_ms(); // Delay if debug mode is enabled
     
+    frame_init();     // Start frame pacing at the default rate
+    profile_init();   // Apply the stored tick rate / panel refresh profile
     start_game();     // Begin the game
 }
 
 void loop() {
     if (!critical_batt) {
-        // Current frame beginning time
-        unsigned long frame_start_time = millis();
-    
-        // Run one game cycle
-        game_cycle();
-        
-        // Enforce ~60hz refresh rate
-        delay_60_hz(frame_start_time);
+        frame_begin();
+
+#ifdef DEBUG
+        // Send 'f' over serial to dump frame pacing stats, 'b' to toggle the ball stress mode (BALL_STRESS),
+        // 'm' to split the balls in play as MULTIBALL does
+        if (Serial.available()) {
+            char c = Serial.read();
+            if (c == 'f')
+                frame_dump_stats();
+#ifdef BALL_STRESS
+            else if (c == 'b')
+                ball_stress_toggle();
+#endif
+            else if (c == 'm')
+                split_balls();
+        }
+#endif
+
+        // Stay at most one frame ahead of the panel, drop the tick if the renderer is stuck
+        if (render_wait_frame(RENDER_FENCE_TIMEOUT_MS)) {
+            // Run one game cycle, its draws are queued for the render task
+            game_cycle();
+            render_end_frame();
+        }
+
+        // Sleep out the rest of the frame period
+        frame_wait();
     }
 }
\ No newline at end of file
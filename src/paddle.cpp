@@ -19,8 +19,8 @@ paddle_t paddle = {
 };
 
 // Macro functions
-float paddle_speed_fn(float speed) {
-    return sqrt(speed) * PADDLE_SPEED_CONST_MUL;
+phys_t paddle_speed_fn(phys_t speed) {
+    return phys_sqrt(speed) * phys_t(PADDLE_SPEED_CONST_MUL);
 }
 
 // Access paddle struct
@@ -28,42 +28,44 @@ paddle_t *get_paddle_info() {
     return &paddle;
 }
 
-void handle_collision() {
+// Ball i landed on top of the paddle, aim it by where it hit
+void paddle_bounce(int i) {
     ball_t *b_info = get_ball_info();
+    ball_pool_t *pool = get_ball_pool();
 
-    if (b_info->y + b_info->radius >= paddle.paddle_y && b_info->y + b_info->radius <= paddle.paddle_y + paddle.paddle_height && b_info->x+b_info->radius >= paddle.paddle_x && b_info->x <= paddle.paddle_x + paddle.paddle_width + b_info->radius) {
-        float hitPos = ((b_info->x + b_info->radius) - (paddle.paddle_x + paddle.paddle_width / 2)) / ((paddle.paddle_width / 2) + b_info->radius);
+    phys_t hitPos = ((pool->x[i] + pool->radius[i]) - (paddle.paddle_x + paddle.paddle_width / 2)) / ((paddle.paddle_width / 2) + pool->radius[i]);
+    hitPos = constrain(hitPos, phys_t(-1), phys_t(1));
 
-        b_info->dx = b_info->speed * hitPos * BOUNCE_FACTOR; // Angle the bounce
-        b_info->dy = -sqrt(b_info->speed * b_info->speed - b_info->dx * b_info->dx); // Adjust dy to preserve total speed
+    pool->dx[i] = b_info->speed * hitPos * phys_t(BOUNCE_FACTOR); // Angle the bounce
+    pool->dy[i] = -phys_sqrt(b_info->speed * b_info->speed - pool->dx[i] * pool->dx[i]); // Adjust dy to preserve total speed
 
-        paddle.target_coord = getRandomInt(3*b_info->radius, paddle.paddle_width-3*b_info->radius); // Where on the paddle to hit next?
-        b_info->hit_paddle = true;
-    } else {
-        b_info->hit_paddle = false;
-    }
+    paddle.target_coord = getRandomInt(3*b_info->radius, paddle.paddle_width-3*b_info->radius); // Where on the paddle to hit next?
 }
 
 // Function that moves the paddle to try and hit the ball
 void incr_paddle_auto() {
     ball_t *b_info = get_ball_info();
+    ball_pool_t *pool = get_ball_pool();
 
     // Paddle logic
     draw_paddle();
 
-    handle_collision();
+    // With several balls in play, chase the one most about to be lost
+    int i = track_ball();
+    if (i < 0)
+        return;
 
-    if (!b_info->ball_on_paddle && (b_info->dy > 0 || abs(b_info -> dx) > paddle.paddle_speed || b_info->y >= SCREEN_HEIGHT/2)) {
-        int padding = b_info->radius;
-        if(b_info->x < paddle.paddle_x + paddle.target_coord - padding) {
+    if (!b_info->ball_on_paddle && (pool->dy[i] > 0 || phys_abs(pool->dx[i]) > paddle.paddle_speed || pool->y[i] >= SCREEN_HEIGHT/2)) {
+        int padding = pool->radius[i];
+        if(pool->x[i] < paddle.paddle_x + paddle.target_coord - padding) {
             movePaddleDraw(-paddle.paddle_speed);
-        } else if (b_info->x > paddle.paddle_x + paddle.target_coord + padding) {
+        } else if (pool->x[i] > paddle.paddle_x + paddle.target_coord + padding) {
             movePaddleDraw(paddle.paddle_speed);
         } else {
-            if (b_info->dx > 0)
-                movePaddleDraw(min(b_info->dx, paddle.paddle_speed));
+            if (pool->dx[i] > 0)
+                movePaddleDraw(min(pool->dx[i], paddle.paddle_speed));
             else
-                movePaddleDraw(max(b_info->dx, -paddle.paddle_speed));
+                movePaddleDraw(max(pool->dx[i], -paddle.paddle_speed));
         }
     }
-}
\ No newline at end of file
+}
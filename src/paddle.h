@@ -5,21 +5,23 @@
 #define BOUNCE_FACTOR 0.9
 
 #ifndef PADDLE_H
+#include "fixed.h"
+
 typedef struct {
     const int paddle_width;
     const int paddle_height;
-    float paddle_x;
+    phys_t paddle_x;
     const int paddle_y;
-    float paddle_speed;
+    phys_t paddle_speed;
     bool left;
     int left_bound;
     int right_bound;
     int target_coord;
 } paddle_t;
 
-float paddle_speed_fn(float speed);
+phys_t paddle_speed_fn(phys_t speed);
 paddle_t *get_paddle_info();
 void incr_paddle_auto();
-void handle_collision();
+void paddle_bounce(int i);
 
 #endif
\ No newline at end of file
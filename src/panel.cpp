@@ -0,0 +1,111 @@
+#include <Arduino.h>
+#include "panel.h"
+
+#ifdef DISPLAY_BACKEND_TFT_ESPI
+#include "esp_log.h"
+
+// TFT_eSPI backend
+// TFT_eSPI tracks its own transaction state, so its primitives can be called
+// inside startWrite()/endWrite() the same way Adafruit's write* calls are.
+// DMA transfers are only waited for when the transaction closes, which lets
+// the strip flush task queue a band and return to its caller.
+
+// Adafruit's setRotation(2) leaves MADCTL MX/MY clear, TFT_eSPI calls that rotation 0
+static const uint8_t espi_rotation[4] = { 2, 3, 0, 1 };
+
+EspiPanel::EspiPanel(int8_t cs, int8_t dc, int8_t rst) : Adafruit_GFX(TFT_WIDTH, TFT_HEIGHT), espi() {}
+
+void EspiPanel::init(uint16_t width, uint16_t height) {
+    espi.init();
+    espi.setSwapBytes(true); // Buffers hold native little-endian RGB565
+    if (!espi.initDMA())
+        ESP_LOGE("DISPLAY", "TFT_eSPI DMA INIT FAIL");
+    _width = WIDTH = width;
+    _height = HEIGHT = height;
+}
+
+void EspiPanel::setRotation(uint8_t r) {
+    Adafruit_GFX::setRotation(r);
+    espi.setRotation(espi_rotation[r & 3]);
+}
+
+void EspiPanel::invertDisplay(bool i) {
+    espi.invertDisplay(i);
+}
+
+void EspiPanel::startWrite() {
+    espi.startWrite();
+}
+
+void EspiPanel::endWrite() {
+    espi.dmaWait();
+    espi.endWrite();
+}
+
+void EspiPanel::setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    espi.dmaWait();
+    espi.setAddrWindow(x, y, w, h);
+}
+
+void EspiPanel::writePixels(uint16_t *colors, uint32_t len, bool block, bool bigEndian) {
+    espi.pushPixels(colors, len);
+}
+
+void EspiPanel::writeColor(uint16_t color, uint32_t len) {
+    espi.pushBlock(color, len);
+}
+
+// Swaps the pixels in place (setSwapBytes), callers hand over scratch buffers only
+void EspiPanel::pushImageDMA(int x, int y, int w, int h, uint16_t *pixels) {
+    espi.pushImageDMA(x, y, w, h, pixels);
+}
+
+void EspiPanel::sendCommand(uint8_t cmd, const uint8_t *data, uint8_t len) {
+    espi.dmaWait();
+    espi.writecommand(cmd);
+    for (int i = 0; i < len; i++)
+        espi.writedata(data[i]);
+}
+
+uint8_t EspiPanel::readcommand8(uint8_t cmd, uint8_t index) {
+    return espi.readcommand8(cmd, index);
+}
+
+// --- PRIMITIVES ---
+void EspiPanel::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    espi.drawPixel(x, y, color);
+}
+
+void EspiPanel::writePixel(int16_t x, int16_t y, uint16_t color) {
+    espi.drawPixel(x, y, color);
+}
+
+void EspiPanel::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    espi.fillRect(x, y, w, h, color);
+}
+
+void EspiPanel::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    espi.fillRect(x, y, w, h, color);
+}
+
+void EspiPanel::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    espi.drawFastHLine(x, y, w, color);
+}
+
+void EspiPanel::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    espi.drawFastHLine(x, y, w, color);
+}
+
+void EspiPanel::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    espi.drawFastVLine(x, y, h, color);
+}
+
+void EspiPanel::writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    espi.drawFastVLine(x, y, h, color);
+}
+
+void EspiPanel::fillScreen(uint16_t color) {
+    espi.fillScreen(color);
+}
+
+#endif
@@ -0,0 +1,53 @@
+#include "Adafruit_GFX.h"
+#include "Adafruit_ST7789.h"
+
+// Display backend, chosen at build time
+// Default is the Adafruit ST7789 driver, build with -D DISPLAY_BACKEND_TFT_ESPI
+// (see the tft_espi env in platformio.ini) to drive the panel through TFT_eSPI
+
+#ifndef PANEL_H
+#define PANEL_H
+
+#ifdef DISPLAY_BACKEND_TFT_ESPI
+#include <TFT_eSPI.h>
+
+// TFT_eSPI behind the Adafruit_SPITFT calls the display code uses
+// Adafruit_GFX still provides text, circles and triangles on top of the
+// primitives below, blocks of pixels go out with TFT_eSPI's DMA
+class EspiPanel : public Adafruit_GFX {
+public:
+    EspiPanel(int8_t cs, int8_t dc, int8_t rst); // Pins come from the TFT_eSPI build flags
+
+    void init(uint16_t width, uint16_t height);
+    void setRotation(uint8_t r) override;
+    void invertDisplay(bool i) override;
+
+    void startWrite() override;
+    void endWrite() override;
+    void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+    void writePixels(uint16_t *colors, uint32_t len, bool block = true, bool bigEndian = false);
+    void writeColor(uint16_t color, uint32_t len);
+    void pushImageDMA(int x, int y, int w, int h, uint16_t *pixels);
+    void sendCommand(uint8_t cmd, const uint8_t *data = NULL, uint8_t len = 0);
+    uint8_t readcommand8(uint8_t cmd, uint8_t index = 0);
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+    void writePixel(int16_t x, int16_t y, uint16_t color) override;
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+    void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+    void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+    void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+    void fillScreen(uint16_t color) override;
+
+private:
+    TFT_eSPI espi;
+};
+
+typedef EspiPanel PanelBase;
+#else
+typedef Adafruit_ST7789 PanelBase;
+#endif
+
+#endif
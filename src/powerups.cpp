@@ -1,9 +1,232 @@
 #include <Arduino.h>
 #include "powerups.h"
 #include "display.h"
+#include "sprite.h"
+#include "strip.h"
+#include "render.h"
+#include "profile.h"
+#include "ball.h"
+#include "paddle.h"
+#include "dirty.h"
+#include "util.h"
+#include "game.h"
 
 
+// Powerup sprites
+// Icons are rasterised once into RGB565 at boot. A falling powerup keeps the
+// pixels it last put on screen (icon over scenery); each frame the new box is
+// composed the same way and only rows that changed are written, which for a
+// one pixel drop is mostly the vacated top row, the new bottom row and the
+// icon's own edges. All fills land in one render-queue batch.
+// Sprites put back scenery only, so a powerup passing a ball or the paddle
+// goes to the dirty list as well, its repaint composes everything back.
+
+#define POWERUP_PIXELS (POWERUP_SIZE * POWERUP_SIZE)
+
 powerup_state_t powerup_state;
+static powerup_stats_t powerup_stats;
+
+static uint16_t powerup_icons[POWERUP_ICONS][POWERUP_PIXELS];
+
+// What each powerup currently shows on screen
+typedef struct {
+    bool drawn;
+    int x, y;
+    uint16_t shown[POWERUP_PIXELS];
+} powerup_sprite_t;
+
+static powerup_sprite_t powerup_sprites[MAX_POWERUPS];
+
+// Scenery under each falling powerup
+static uint16_t powerup_under_pixels[MAX_POWERUPS][POWERUP_PIXELS];
+static save_under_t powerup_under[MAX_POWERUPS];
+
+// Scratch for the box a powerup is moving into
+static uint16_t next_under_pixels[POWERUP_PIXELS];
+static save_under_t next_under;
+static uint16_t next_shown[POWERUP_PIXELS];
+
+powerup_state_t *get_powerup_state() {
+    return &powerup_state;
+}
+
+powerup_stats_t *get_powerup_stats() {
+    return &powerup_stats;
+}
+
+void powerups_init() {
+    StripCanvas canvas;
+    int c = POWERUP_SIZE / 2;
+
+    for (int i = 0; i < POWERUP_ICONS; i++) {
+        canvas.attach(powerup_icons[i]);
+        canvas.setBand(0, 0, POWERUP_SIZE, POWERUP_SIZE);
+        canvas.fillScreen(POWERUP_KEY_COLOR);
+        switch (i) {
+            case LARGEBALL: drawLargeBall(canvas, c, c); break;
+            case MULTIBALL: drawExtraBalls(canvas, c, c); break;
+            case PLUSONE: drawPlusOne(canvas, c, c); break;
+            case LASER: drawLaser(canvas, c, c); break;
+        }
+    }
+
+    for (int i = 0; i < MAX_POWERUPS; i++)
+        save_under_attach(&powerup_under[i], powerup_under_pixels[i], POWERUP_PIXELS);
+    save_under_attach(&next_under, next_under_pixels, POWERUP_PIXELS);
+}
+
+// Icon over the scenery captured in under
+static void compose_powerup(uint16_t *out, const uint16_t *icon, const save_under_t *under) {
+    for (int i = 0; i < POWERUP_PIXELS; i++) {
+        if (icon[i] != POWERUP_KEY_COLOR)
+            out[i] = icon[i];
+        else
+            out[i] = under->valid ? under->pixels[i] : ~ST77XX_BLACK;
+    }
+}
+
+// Queue one row of a box, a fill per run of equal colour
+static void write_row(int x, int sy, const uint16_t *row) {
+    int run = 0;
+    for (int i = 1; i <= POWERUP_SIZE; i++) {
+        if (i == POWERUP_SIZE || row[i] != row[run]) {
+            render_hspan(x + run, sy, i - run, row[run]);
+            run = i;
+        }
+    }
+}
+
+// Move a powerup's pixels from where they are shown to (x, y)
+static void move_powerup_sprite(int idx, int x, int y, powerup_id id) {
+    powerup_sprite_t *spr = &powerup_sprites[idx];
+    save_under_t *under = &powerup_under[idx];
+
+    // Boxes hanging off screen are not captured, fall back to black scenery
+    save_under_capture(&next_under, x, y, POWERUP_SIZE, POWERUP_SIZE);
+    if (next_under.valid && (next_under.w != POWERUP_SIZE || next_under.h != POWERUP_SIZE))
+        next_under.valid = false;
+    compose_powerup(next_shown, powerup_icons[id], &next_under);
+
+    bool same_column = spr->drawn && spr->x == x;
+    for (int r = 0; r < POWERUP_SIZE; r++) {
+        int sy = y + r;
+        if (sy < 0 || sy >= SCREEN_HEIGHT)
+            continue;
+        const uint16_t *row = &next_shown[r * POWERUP_SIZE];
+
+        // Row already on screen with the same pixels
+        int old_r = sy - spr->y;
+        if (same_column && old_r >= 0 && old_r < POWERUP_SIZE &&
+            memcmp(row, &spr->shown[old_r * POWERUP_SIZE], POWERUP_SIZE * sizeof(uint16_t)) == 0) {
+            powerup_stats.rows_skipped++;
+            continue;
+        }
+
+        write_row(x, sy, row);
+        powerup_stats.rows_written++;
+    }
+
+    // Rows of the old box the new one no longer covers
+    if (spr->drawn) {
+        for (int r = 0; r < POWERUP_SIZE; r++) {
+            int sy = spr->y + r;
+            if (!same_column || sy < y || sy >= y + POWERUP_SIZE)
+                save_under_restore_span(under, sy, spr->x, spr->x + POWERUP_SIZE - 1);
+        }
+    }
+
+    memcpy(spr->shown, next_shown, sizeof(next_shown));
+    memcpy(under->pixels, next_under.pixels, sizeof(next_under_pixels));
+    under->x = next_under.x;
+    under->y = next_under.y;
+    under->w = next_under.w;
+    under->h = next_under.h;
+    under->valid = next_under.valid;
+    spr->x = x;
+    spr->y = y;
+    spr->drawn = true;
+}
+
+static void erase_powerup_sprite(int idx) {
+    powerup_sprite_t *spr = &powerup_sprites[idx];
+    if (!spr->drawn)
+        return;
+    save_under_restore(&powerup_under[idx], spr->x, spr->y, POWERUP_SIZE, POWERUP_SIZE);
+    spr->drawn = false;
+}
+
+// Where a powerup is shown, false when it isn't
+bool powerup_drawn_box(int idx, int *x, int *y) {
+    const powerup_sprite_t *spr = &powerup_sprites[idx];
+    if (!spr->drawn)
+        return false;
+    *x = spr->x;
+    *y = spr->y;
+    return true;
+}
+
+// Icon pixels only, for repaints composing the scene at (x, y)
+void powerup_draw_icon(Adafruit_GFX &g, powerup_id id, int x, int y) {
+    const uint16_t *icon = powerup_icons[id];
+    for (int r = 0; r < POWERUP_SIZE; r++) {
+        const uint16_t *row = &icon[r * POWERUP_SIZE];
+        int run = 0;
+        for (int i = 1; i <= POWERUP_SIZE; i++) {
+            if (i == POWERUP_SIZE || row[i] != row[run]) {
+                if (row[run] != POWERUP_KEY_COLOR)
+                    g.fillRect(x + run, y + r, i - run, 1, row[run]);
+                run = i;
+            }
+        }
+    }
+}
+
+// Put the scenery back under every powerup, before the scenery itself moves
+// They are drawn again from a fresh capture on the next update
+void erase_powerups() {
+    for (int i = 0; i < MAX_POWERUPS; i++)
+        erase_powerup_sprite(i);
+}
+
+// Drop everything falling, the screen is about to be redrawn
+void clear_powerups() {
+    for (int i = 0; i < MAX_POWERUPS; i++) {
+        powerup_state.active_powerups[i].active = false;
+        powerup_sprites[i].drawn = false;
+    }
+    powerup_state.num_active = 0;
+    powerup_state.lowest_idx = 0;
+}
+
+// Maybe drop a random powerup centred on (x, y), called as a brick breaks
+void drop_powerup(int x, int y) {
+    if (getRandomInt(1, POWERUP_DROP_CHANCE) != 1)
+        return;
+    powerup_id id = (powerup_id)getRandomInt(0, POWERUP_DROP_KINDS - 1);
+    add_powerup(x - POWERUP_SIZE / 2, y - POWERUP_SIZE / 2, id);
+}
+
+static bool boxes_overlap(int ax, int ay, int bx, int by) {
+    return abs(ax - bx) < POWERUP_SIZE && abs(ay - by) < POWERUP_SIZE;
+}
+
+// A box over the paddle's rows (it erases its trail across them), any ball or
+// another powerup, shown or about to move
+static bool covers_sprites(int idx, int x, int y) {
+    paddle_t *p_info = get_paddle_info();
+    if (y < p_info->paddle_y + p_info->paddle_height && p_info->paddle_y < y + POWERUP_SIZE)
+        return true;
+
+    for (int i = 0; i < MAX_POWERUPS; i++) {
+        const powerup_instance *p = &powerup_state.active_powerups[i];
+        if (i == idx || !p->active)
+            continue;
+        const powerup_sprite_t *spr = &powerup_sprites[i];
+        if (boxes_overlap(x, y, (int)p->x, (int)p->y) || (spr->drawn && boxes_overlap(x, y, spr->x, spr->y)))
+            return true;
+    }
+    return covers_ball(x, y, POWERUP_SIZE, POWERUP_SIZE);
+}
 
 void add_powerup(int x, int y, powerup_id id) {
     int idx = powerup_state.lowest_idx;
@@ -15,9 +238,10 @@ void add_powerup(int x, int y, powerup_id id) {
 
     // Insert at lowest_idx
     powerup_state.active_powerups[idx].active = true;
-    powerup_state.active_powerups[idx].x = (float)x;
-    powerup_state.active_powerups[idx].y = (float)y;
+    powerup_state.active_powerups[idx].x = x;
+    powerup_state.active_powerups[idx].y = y;
     powerup_state.active_powerups[idx].id = id;
+    powerup_sprites[idx].drawn = false;
 
     powerup_state.num_active++;
 
@@ -31,30 +255,36 @@ void add_powerup(int x, int y, powerup_id id) {
     }
 }
 
-void draw_powerup(powerup_instance *p) {
-    int x = p->x;
-    int y = p->y;
-    switch (p->id)
-    {
-    case LARGEBALL:
-        drawLargeBall(x, y);
-        break;
-
-    case MULTIBALL:
-        drawExtraBalls(x, y);
-        break;
-
-    case PLUSONE:
-        drawPlusOne(x, y);
-        break;
-
-    case LASER:
-        drawLaser(x, y);
-        break;
-    
-    default:
-        ESP_LOGE("GENERAL ERROR", "NONEXISTENT POWERUP");
-        break;
+// Caught by the paddle
+static void apply_powerup(powerup_id id) {
+    game_t *g_info = get_game_info();
+    switch (id) {
+        case LARGEBALL: grow_balls(); break;
+        case MULTIBALL: split_balls(); break;
+        case PLUSONE: g_info->lives = min(g_info->lives + 1, MAX_LIVES); break;
+        default: break;
+    }
+}
+
+static bool over_paddle(int x, int y) {
+    paddle_t *p_info = get_paddle_info();
+    int px = paddle_pixel_x(p_info->paddle_x);
+    return x < px + p_info->paddle_width && px < x + POWERUP_SIZE &&
+           y < p_info->paddle_y + p_info->paddle_height && p_info->paddle_y < y + POWERUP_SIZE;
+}
+
+// Take a powerup out of play, repainting what it leaves if a sprite is under it
+static void remove_powerup(int i) {
+    const powerup_sprite_t *spr = &powerup_sprites[i];
+    if (spr->drawn && covers_sprites(i, spr->x, spr->y))
+        dirty_add(spr->x, spr->y, POWERUP_SIZE, POWERUP_SIZE);
+    erase_powerup_sprite(i);
+    powerup_state.active_powerups[i].active = false;
+    powerup_state.num_active--;
+
+    // Update lowest_idx if needed
+    if (i < powerup_state.lowest_idx) {
+        powerup_state.lowest_idx = i;
     }
 }
 
@@ -63,25 +293,27 @@ void update_powerups() {
         powerup_instance* p = &powerup_state.active_powerups[i];
         if (!p->active) continue;
 
-        // Erase previous position (black 10x10 shadow)
-        draw_rect((int)p->x, (int)p->y, 10, 10, ~ST77XX_BLACK);
-
         // Update y position
-        p->y += POWERUP_DROP_SPEED;
+        p->y += phys_t(POWERUP_DROP_SPEED) * get_tick_scale();
 
-        // Check if it fell off the screen
+        // Check if it fell off the screen or landed on the paddle
         if (p->y >= SCREEN_HEIGHT) {
-            p->active = false;
-            powerup_state.num_active--;
-
-            // Update lowest_idx if needed
-            if (i < powerup_state.lowest_idx) {
-                powerup_state.lowest_idx = i;
-            }
+            remove_powerup(i);
+            continue;
+        } else if (over_paddle((int)p->x, (int)p->y)) {
+            remove_powerup(i);
+            apply_powerup(p->id);
             continue;
+        } else if (p->id < POWERUP_ICONS) {
+            int x = (int)p->x, y = (int)p->y;
+            const powerup_sprite_t *spr = &powerup_sprites[i];
+            if (spr->drawn && covers_sprites(i, spr->x, spr->y))
+                dirty_add(spr->x, spr->y, POWERUP_SIZE, POWERUP_SIZE);
+            if (covers_sprites(i, x, y))
+                dirty_add(x, y, POWERUP_SIZE, POWERUP_SIZE);
+            move_powerup_sprite(i, x, y, p->id);
         } else {
-            // draw the powerup
-            draw_powerup(p);
+            ESP_LOGE("GENERAL ERROR", "NONEXISTENT POWERUP");
         }
 
     }
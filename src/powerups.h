@@ -1,8 +1,15 @@
-
 #ifndef POWERUPS_H
 #define POWERUPS_H
 
+#include "fixed.h"
+
 #define POWERUP_DROP_SPEED 1.0f
+#define POWERUP_SIZE 10
+#define MAX_POWERUPS 10
+#define POWERUP_ICONS 4
+#define POWERUP_KEY_COLOR 0x0821 // Transparent in the pre-rasterised icons
+#define POWERUP_DROP_CHANCE 6    // One in this many destroyed bricks drops a powerup
+#define POWERUP_DROP_KINDS 3     // Dropped ids are LARGEBALL up to PLUSONE, LASER has no mechanic yet
 
 enum powerup_id {
     LARGEBALL,
@@ -13,8 +20,8 @@ enum powerup_id {
 
 typedef struct {
     bool active;
-    float x;
-    float y;
+    phys_t x;
+    phys_t y;
     powerup_id id;
 } powerup_instance;
 
@@ -25,6 +32,24 @@ typedef struct {
     int num_active;
 } powerup_state_t;
 
-
-
-#endif
\ No newline at end of file
+// Rows move_powerup_sprite wrote and skipped as already on screen
+typedef struct {
+    uint32_t rows_written;
+    uint32_t rows_skipped;
+} powerup_stats_t;
+
+class Adafruit_GFX;
+
+// Function declarations
+void powerups_init();
+void add_powerup(int x, int y, powerup_id id);
+void update_powerups();
+void erase_powerups();
+void clear_powerups();
+void drop_powerup(int x, int y);
+bool powerup_drawn_box(int idx, int *x, int *y);
+void powerup_draw_icon(Adafruit_GFX &g, powerup_id id, int x, int y);
+powerup_state_t *get_powerup_state();
+powerup_stats_t *get_powerup_stats();
+
+#endif
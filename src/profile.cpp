@@ -0,0 +1,62 @@
+#include <Arduino.h>
+#include "profile.h"
+#include "frame.h"
+#include "beam.h"
+#include "display.h"
+#include "system.h"
+#include "esp_log.h"
+
+// Performance profiles
+// A profile pairs the game tick rate with the panel refresh, so frames are
+// shown at an even cadence. Movement is scaled by BASE_TICK_RATE / tick rate,
+// which keeps ball and paddle speed in px per second the same everywhere.
+// FRCTRL2 bottoms out at 39Hz, the battery saver shows each 30Hz tick for
+// two 60Hz refreshes instead.
+
+static const perf_profile_t profiles[NUM_PROFILES] = {
+    { "Saver 30Hz",   30, 0x0F, 60 },
+    { "Normal 60Hz",  60, 0x0F, 60 },
+    { "Compete 75Hz", 75, 0x09, 75 },
+};
+
+static int profile_index = DEFAULT_PROFILE;
+static phys_t tick_scale = 1;
+
+const perf_profile_t *get_profile() {
+    return &profiles[profile_index];
+}
+
+int get_profile_index() {
+    return profile_index;
+}
+
+// Multiply per-tick movement by this
+phys_t get_tick_scale() {
+    return tick_scale;
+}
+
+void profile_apply(int index) {
+    if (index < 0 || index >= NUM_PROFILES)
+        index = DEFAULT_PROFILE;
+
+    const perf_profile_t *p = &profiles[index];
+    profile_index = index;
+    tick_scale = phys_t(BASE_TICK_RATE) / phys_t((int)p->tick_hz);
+
+    set_panel_refresh(p->frctrl2);
+    beam_set_refresh(p->refresh_hz);
+    frame_set_rate(p->tick_hz);
+
+    ESP_LOGI("SYSTEM", "PROFILE %s (TICK %u HZ, PANEL %u HZ)", p->name, (unsigned)p->tick_hz, (unsigned)p->refresh_hz);
+}
+
+// Switch to the next profile and remember it
+void profile_next() {
+    profile_apply((profile_index + 1) % NUM_PROFILES);
+    set_profile_setting(profile_index);
+}
+
+// Apply the stored profile, needs the display and NVS up
+void profile_init() {
+    profile_apply(get_profile_setting());
+}
@@ -0,0 +1,31 @@
+#include <Arduino.h>
+
+// ST7789 frame rate control in normal mode
+#define ST7789_FRCTRL2 0xC6
+
+// Performance profiles
+#define NUM_PROFILES 3
+#define DEFAULT_PROFILE 1
+#define BASE_TICK_RATE 60 // Ball and paddle speeds are tuned in px per tick at this rate
+
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include "fixed.h"
+
+typedef struct {
+    const char *name;       // Shown in the pause menu
+    uint32_t tick_hz;       // Game loop rate
+    uint8_t frctrl2;        // Panel refresh, RTNA field of FRCTRL2
+    uint32_t refresh_hz;    // What that FRCTRL2 value gives
+} perf_profile_t;
+
+// Function declarations
+const perf_profile_t *get_profile();
+int get_profile_index();
+phys_t get_tick_scale();
+void profile_apply(int index);
+void profile_next();
+void profile_init();
+
+#endif
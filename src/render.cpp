@@ -0,0 +1,256 @@
+#include <Arduino.h>
+#include "render.h"
+#include "scroll.h"
+#include "display.h"
+#include "strip.h"
+#include "font.h"
+#include "beam.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+
+// Render pipeline
+// The game loop on core 1 only records what to draw into a single-producer /
+// single-consumer ring, the render task on core 0 executes it against the
+// panel. Each frame ends with a fence, so the game can run physics for frame
+// N+1 while frame N is on the bus and still bound how far ahead it gets.
+// Anything that touches the panel directly drains the ring first (see
+// ScrollST7789::startWrite), so commands and direct draws never reorder.
+
+#define RENDER_QUEUE_MASK (RENDER_QUEUE_SIZE - 1)
+
+extern ScrollST7789 tft;
+
+static draw_cmd_t render_queue[RENDER_QUEUE_SIZE];
+static volatile uint32_t queue_head = 0; // Written by the producer only
+static volatile uint32_t queue_tail = 0; // Written by the consumer only
+static TaskHandle_t render_task_handle = NULL;
+
+render_stats_t render_stats = { 0, 0, 0, 0, 0 };
+
+render_stats_t *get_render_stats() {
+    return &render_stats;
+}
+
+// --- PRODUCER ---
+static void push_cmd(const draw_cmd_t &cmd) {
+    // Queue not running yet, nothing to order against
+    if (render_task_handle == NULL) {
+        return;
+    }
+
+    if (queue_head - queue_tail >= RENDER_QUEUE_SIZE) {
+        render_stats.queue_full_waits++;
+        xTaskNotifyGive(render_task_handle);
+        while (queue_head - queue_tail >= RENDER_QUEUE_SIZE)
+            taskYIELD();
+    }
+
+    render_queue[queue_head & RENDER_QUEUE_MASK] = cmd;
+    __sync_synchronize(); // Command must be visible before the new head
+    queue_head = queue_head + 1;
+
+    if (queue_head - queue_tail == RENDER_QUEUE_SIZE / 2)
+        xTaskNotifyGive(render_task_handle);
+}
+
+void render_fill_rect(int x, int y, int w, int h, uint16_t color) {
+    if (render_task_handle == NULL) {
+        tft.fillRect(x, y, w, h, color);
+        return;
+    }
+    push_cmd({ CMD_FILL_RECT, 0, (int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h, color, 0 });
+}
+
+void render_hspan(int x, int y, int w, uint16_t color) {
+    render_fill_rect(x, y, w, 1, color);
+}
+
+void render_fill_circle(int x, int y, int radius, uint16_t color) {
+    if (render_task_handle == NULL) {
+        tft.fillCircle(x, y, radius, color);
+        return;
+    }
+    push_cmd({ CMD_FILL_CIRCLE, 0, (int16_t)x, (int16_t)y, (int16_t)radius, 0, color, 0 });
+}
+
+void render_draw_circle(int x, int y, int radius, uint16_t color) {
+    if (render_task_handle == NULL) {
+        tft.drawCircle(x, y, radius, color);
+        return;
+    }
+    push_cmd({ CMD_DRAW_CIRCLE, 0, (int16_t)x, (int16_t)y, (int16_t)radius, 0, color, 0 });
+}
+
+void render_char(int x, int y, char c, uint16_t color, uint16_t bg, uint8_t size) {
+    if (render_task_handle == NULL) {
+        font_draw_char(tft, x, y, c, color, bg, size);
+        return;
+    }
+    push_cmd({ CMD_CHAR, (uint8_t)c, (int16_t)x, (int16_t)y, (int16_t)size, 0, color, bg });
+}
+
+// Repaint a region from the scene snapshot in scene_slot
+void render_region(int x, int y, int w, int h, uint8_t scene_slot) {
+    if (render_task_handle == NULL) {
+        draw_scene_region(x, y, w, h, scene_slot);
+        return;
+    }
+    push_cmd({ CMD_REGION, scene_slot, (int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h, 0, 0 });
+}
+
+void render_end_frame() {
+    render_stats.frames_submitted++;
+    if (render_task_handle == NULL) {
+        render_stats.frames_done++;
+        return;
+    }
+    push_cmd({ CMD_FENCE, 0, 0, 0, 0, 0, 0, 0 });
+    xTaskNotifyGive(render_task_handle);
+}
+
+uint32_t render_frames_in_flight() {
+    return render_stats.frames_submitted - render_stats.frames_done;
+}
+
+// Block until the renderer is within RENDER_MAX_FRAMES_IN_FLIGHT frames
+// Returns false if it is still behind after timeout_ms, the caller should skip a tick
+bool render_wait_frame(uint32_t timeout_ms) {
+    int64_t deadline = esp_timer_get_time() + (int64_t)timeout_ms * 1000;
+    while (render_frames_in_flight() > RENDER_MAX_FRAMES_IN_FLIGHT) {
+        if (esp_timer_get_time() >= deadline) {
+            render_stats.frames_skipped++;
+            return false;
+        }
+        taskYIELD();
+    }
+    return true;
+}
+
+// Wait for every queued command to reach the panel
+// No-op on the tasks that execute commands, they are the ones being waited on
+void render_sync() {
+    if (render_task_handle == NULL)
+        return;
+    TaskHandle_t self = xTaskGetCurrentTaskHandle();
+    if (self == render_task_handle || strip_is_flush_task())
+        return;
+
+    if (queue_tail != queue_head) {
+        render_stats.syncs++;
+        xTaskNotifyGive(render_task_handle);
+        while (queue_tail != queue_head)
+            taskYIELD();
+    }
+
+    // The last region's final band may still be on the bus
+    strip_finish();
+}
+
+// --- CONSUMER ---
+// End of the run of fills starting at tail, and the rows and pixels it covers
+// With beam racing a run is also cut where it would grow taller than a band
+static uint32_t fill_run_end(uint32_t tail, int *y0, int *y1, uint32_t *pixels) {
+    *y0 = INT16_MAX;
+    *y1 = INT16_MIN;
+    *pixels = 0;
+
+    while (tail != queue_head) {
+        const draw_cmd_t &cmd = render_queue[tail & RENDER_QUEUE_MASK];
+        if (cmd.type != CMD_FILL_RECT)
+            break;
+
+        int top = min(*y0, (int)cmd.y);
+        int bottom = max(*y1, cmd.y + cmd.h);
+#ifdef USE_BEAM_RACING
+        if (*pixels > 0 && bottom - top > BEAM_BAND_ROWS)
+            break;
+#endif
+        *y0 = top;
+        *y1 = bottom;
+        *pixels += cmd.w * cmd.h;
+        tail++;
+    }
+    return tail;
+}
+
+static void render_task(void *pvParameters) {
+    while (true) {
+        if (queue_tail == queue_head) {
+            ulTaskNotifyTake(pdTRUE, 1);
+            continue;
+        }
+
+        // Consecutive fills share one SPI transaction, the tail only moves
+        // past them once the transaction is closed
+        uint32_t tail = queue_tail;
+
+        while (tail != queue_head) {
+            const draw_cmd_t &cmd = render_queue[tail & RENDER_QUEUE_MASK];
+            int y0, y1;
+            uint32_t pixels;
+
+            // Regions return with their last band flushing on the other core,
+            // back to back regions keep it overlapped, anything else waits for it
+            if (cmd.type != CMD_REGION)
+                strip_finish();
+
+            if (cmd.type == CMD_FILL_RECT) {
+                uint32_t end = fill_run_end(tail, &y0, &y1, &pixels);
+                beam_wait(y0, y1, pixels);
+                tft.startWrite();
+                for (; tail != end; tail++) {
+                    const draw_cmd_t &fill = render_queue[tail & RENDER_QUEUE_MASK];
+                    tft.writeFillRect(fill.x, fill.y, fill.w, fill.h, fill.color);
+                }
+                tft.endWrite();
+                __sync_synchronize();
+                queue_tail = tail;
+                continue;
+            }
+
+            switch (cmd.type) {
+                case CMD_FILL_CIRCLE:
+                case CMD_DRAW_CIRCLE:
+                    beam_wait(cmd.y - cmd.w, cmd.y + cmd.w + 1, (2 * cmd.w + 1) * (2 * cmd.w + 1));
+                    if (cmd.type == CMD_FILL_CIRCLE)
+                        tft.fillCircle(cmd.x, cmd.y, cmd.w, cmd.color);
+                    else
+                        tft.drawCircle(cmd.x, cmd.y, cmd.w, cmd.color);
+                    break;
+                case CMD_CHAR:
+                    beam_wait(cmd.y, cmd.y + FONT_CHAR_H * cmd.w, FONT_CHAR_W * FONT_CHAR_H * cmd.w * cmd.w);
+                    font_draw_char(tft, cmd.x, cmd.y, cmd.arg, cmd.color, cmd.bg, cmd.w);
+                    break;
+                case CMD_REGION:
+                    // Bands wait on the beam in the strip flush task, on the other core
+                    draw_scene_region(cmd.x, cmd.y, cmd.w, cmd.h, cmd.arg);
+                    break;
+                case CMD_FENCE:
+                    beam_end_frame();
+                    render_stats.frames_done++;
+                    break;
+                default:
+                    ESP_LOGE("RENDER", "UNKNOWN DRAW COMMAND %d", cmd.type);
+                    break;
+            }
+            tail++;
+            __sync_synchronize();
+            queue_tail = tail;
+        }
+    }
+}
+
+// --- INIT ---
+void render_init() {
+    xTaskCreatePinnedToCore(
+        render_task,
+        "Render",
+        4096,
+        NULL,
+        RENDER_TASK_PRIORITY,
+        &render_task_handle,
+        RENDER_TASK_CORE
+    );
+
+    ESP_LOGI("DISPLAY", "RENDER TASK INIT (%d COMMAND QUEUE)", RENDER_QUEUE_SIZE);
+}
@@ -0,0 +1,55 @@
+#include <Arduino.h>
+
+// Render pipeline constants
+#define RENDER_QUEUE_SIZE 256          // Commands, must be a power of two
+#define RENDER_TASK_CORE 0
+#define RENDER_TASK_PRIORITY 2
+#define RENDER_MAX_FRAMES_IN_FLIGHT 1  // Frames the game may run ahead of the panel
+#define RENDER_SCENE_SLOTS (RENDER_MAX_FRAMES_IN_FLIGHT + 1)
+#define RENDER_FENCE_TIMEOUT_MS 50
+
+#ifndef RENDER_H
+#define RENDER_H
+
+enum draw_cmd_type {
+    CMD_FILL_RECT,
+    CMD_FILL_CIRCLE,
+    CMD_DRAW_CIRCLE,
+    CMD_CHAR,
+    CMD_REGION,
+    CMD_FENCE
+};
+
+// One queued draw, 16 bytes
+typedef struct {
+    uint8_t type;
+    uint8_t arg;        // CMD_CHAR: glyph, CMD_REGION: scene slot
+    int16_t x, y;
+    int16_t w, h;       // Circles: w is the radius, CMD_CHAR: w is the text size
+    uint16_t color;
+    uint16_t bg;
+} draw_cmd_t;
+
+typedef struct {
+    uint32_t frames_submitted;
+    uint32_t frames_done;
+    uint32_t frames_skipped;    // Game ticks dropped because the renderer fell behind
+    uint32_t queue_full_waits;  // Pushes that had to wait for space
+    uint32_t syncs;             // Direct panel accesses that drained the queue
+} render_stats_t;
+
+// Function declarations
+void render_init();
+render_stats_t *get_render_stats();
+void render_fill_rect(int x, int y, int w, int h, uint16_t color);
+void render_hspan(int x, int y, int w, uint16_t color);
+void render_fill_circle(int x, int y, int radius, uint16_t color);
+void render_draw_circle(int x, int y, int radius, uint16_t color);
+void render_char(int x, int y, char c, uint16_t color, uint16_t bg, uint8_t size);
+void render_region(int x, int y, int w, int h, uint8_t scene_slot);
+void render_end_frame();
+bool render_wait_frame(uint32_t timeout_ms);
+uint32_t render_frames_in_flight();
+void render_sync();
+
+#endif
@@ -0,0 +1,194 @@
+#include <Arduino.h>
+#include "scroll.h"
+#include "display.h"
+#include "game.h"
+#include "render.h"
+#include "beam.h"
+
+// Hardware vertical scrolling
+// setRotation(2) leaves MADCTL MY clear on the ST7789, so panel memory rows run
+// top to bottom in the same order as screen rows and the top fixed area (TFA)
+// is the header. Scrolling the band down by n rows moves the start address
+// back by n, content drawn at memory row m then shows at screen row m + n.
+
+static void send_u16_params(ScrollST7789 *tft, uint8_t cmd, const uint16_t *values, int count) {
+    uint8_t data[6];
+    for (int i = 0; i < count; i++) {
+        data[2 * i] = values[i] >> 8;
+        data[2 * i + 1] = values[i] & 0xFF;
+    }
+    tft->sendCommand(cmd, data, 2 * count);
+}
+
+void ScrollST7789::setScrollArea(int top, int bottom) {
+    scroll_top = top;
+    scroll_height = bottom - top;
+    scroll_offset = 0;
+
+    uint16_t def[3] = { (uint16_t)top, (uint16_t)scroll_height, (uint16_t)(SCREEN_HEIGHT - bottom) };
+    send_u16_params(this, ST7789_VSCRDEF, def, 3);
+    setScroll(0);
+}
+
+// Offset is how far the band content has moved down, in rows
+void ScrollST7789::setScroll(int offset) {
+    if (scroll_height <= 0)
+        return;
+    // Queued draws were recorded against the old mapping
+    render_sync();
+    scroll_offset = ((offset % scroll_height) + scroll_height) % scroll_height;
+
+    uint16_t start = scroll_top + (scroll_height - scroll_offset) % scroll_height;
+    send_u16_params(this, ST7789_VSCSAD, &start, 1);
+}
+
+void ScrollST7789::startWrite() {
+    render_sync();
+    PanelBase::startWrite();
+}
+
+void ScrollST7789::scrollBy(int amount) {
+    setScroll(scroll_offset + amount);
+}
+
+int ScrollST7789::mapRow(int y) {
+    if (scroll_offset == 0 || y < scroll_top || y >= scroll_top + scroll_height)
+        return y;
+    return scroll_top + (y - scroll_top - scroll_offset + scroll_height) % scroll_height;
+}
+
+// Split logical rows into runs that are contiguous in panel memory
+// At most 4: above the band, two halves of the band around the wrap, below it
+int ScrollST7789::mapRows(int y, int h, scroll_run_t *runs) {
+    int n = 0;
+    int y1 = min(y + h, SCREEN_HEIGHT);
+    y = max(y, 0);
+    if (y >= y1)
+        return 0;
+
+    if (scroll_offset == 0) {
+        runs[n++] = { y, y, y1 - y };
+        return n;
+    }
+
+    int band_end = scroll_top + scroll_height;
+
+    if (y < scroll_top) {
+        int e = min(y1, scroll_top);
+        runs[n++] = { y, y, e - y };
+        y = e;
+    }
+
+    int e = min(y1, band_end);
+    while (y < e) {
+        int m = mapRow(y) - scroll_top;
+        int len = min(e - y, scroll_height - m); // Rows until memory wraps
+        runs[n++] = { y, scroll_top + m, len };
+        y += len;
+    }
+
+    if (y < y1)
+        runs[n++] = { y, y, y1 - y };
+
+    return n;
+}
+
+// Stream a block of pixels to screen coordinates, caller holds startWrite()
+void ScrollST7789::writeRect(int x, int y, int w, int h, uint16_t *pixels) {
+    scroll_run_t runs[SCROLL_MAX_RUNS];
+    int n = mapRows(y, h, runs);
+    for (int i = 0; i < n; i++) {
+#ifdef DISPLAY_BACKEND_TFT_ESPI
+        pushImageDMA(x, runs[i].mem_y, w, runs[i].h, pixels + (runs[i].y - y) * w);
+#else
+        setAddrWindow(x, runs[i].mem_y, w, runs[i].h);
+        writePixels(pixels + (runs[i].y - y) * w, w * runs[i].h);
+#endif
+    }
+}
+
+#ifndef DISPLAY_BACKEND_TFT_ESPI
+// Read panel memory back with RAMRD, in panel coordinates
+// The ST7789 returns 18-bit pixels after a dummy byte and reads are only specified
+// up to ~6.6MHz, the caller drops the SPI clock first
+void ScrollST7789::readRect(int x, int y, int w, int h, uint16_t *out) {
+    startWrite();
+    setAddrWindow(x, y, w, h);
+    writeCommand(ST77XX_RAMRD);
+    spiRead(); // Dummy
+    for (int i = 0; i < w * h; i++) {
+        uint8_t r = spiRead();
+        uint8_t g = spiRead();
+        uint8_t b = spiRead();
+        out[i] = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+    }
+    endWrite();
+}
+
+// Display line being refreshed (GSCAN), caller drops the SPI clock first
+// The reply is one dummy clock followed by a 16-bit line number
+int ScrollST7789::readScanline() {
+    startWrite();
+    writeCommand(ST7789_GSCAN);
+    uint32_t raw = spiRead();
+    raw = (raw << 8) | spiRead();
+    raw = (raw << 8) | spiRead();
+    endWrite();
+    return (raw >> 7) & 0xFFFF;
+}
+#endif
+
+// --- REMAPPED PRIMITIVES ---
+void ScrollST7789::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    PanelBase::drawPixel(x, mapRow(y), color);
+}
+
+void ScrollST7789::writePixel(int16_t x, int16_t y, uint16_t color) {
+    PanelBase::writePixel(x, mapRow(y), color);
+}
+
+void ScrollST7789::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    PanelBase::drawFastHLine(x, mapRow(y), w, color);
+}
+
+void ScrollST7789::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    PanelBase::writeFastHLine(x, mapRow(y), w, color);
+}
+
+void ScrollST7789::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (scroll_offset == 0) {
+        PanelBase::fillRect(x, y, w, h, color);
+        return;
+    }
+    if (h < 0) {
+        y += h + 1;
+        h = -h;
+    }
+    scroll_run_t runs[SCROLL_MAX_RUNS];
+    int n = mapRows(y, h, runs);
+    for (int i = 0; i < n; i++)
+        PanelBase::fillRect(x, runs[i].mem_y, w, runs[i].h, color);
+}
+
+void ScrollST7789::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (scroll_offset == 0) {
+        PanelBase::writeFillRect(x, y, w, h, color);
+        return;
+    }
+    if (h < 0) {
+        y += h + 1;
+        h = -h;
+    }
+    scroll_run_t runs[SCROLL_MAX_RUNS];
+    int n = mapRows(y, h, runs);
+    for (int i = 0; i < n; i++)
+        PanelBase::writeFillRect(x, runs[i].mem_y, w, runs[i].h, color);
+}
+
+void ScrollST7789::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    fillRect(x, y, 1, h, color);
+}
+
+void ScrollST7789::writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    writeFillRect(x, y, 1, h, color);
+}
@@ -0,0 +1,61 @@
+#include "panel.h"
+
+// ST7789 vertical scroll commands
+#define ST7789_VSCRDEF 0x33 // Vertical scroll definition (TFA, VSA, BFA)
+#define ST7789_VSCSAD 0x37  // Vertical scroll start address
+
+// Scrolling playfield, between the header and the lose boundary
+#define SCROLL_TOP HEADER_HEIGHT
+#define SCROLL_BOTTOM MIN_BRICK_HEIGHT
+#define SCROLL_HEIGHT (SCROLL_BOTTOM - SCROLL_TOP)
+#define SCROLL_MAX_RUNS 4
+
+#ifndef SCROLL_H
+#define SCROLL_H
+
+// Logical rows [y, y + h) live in panel memory rows [mem_y, mem_y + h)
+typedef struct {
+    int y;
+    int mem_y;
+    int h;
+} scroll_run_t;
+
+// ST7789 with a hardware-scrolled band, on either display backend
+// Once the band is scrolled, a screen row no longer sits at the same panel
+// memory row. Every GFX primitive is remapped here so the rest of the display
+// code keeps drawing in screen coordinates. Direct access also drains the
+// render queue first, so queued and direct draws reach the panel in order.
+class ScrollST7789 : public PanelBase {
+public:
+    using PanelBase::PanelBase;
+
+    void setScrollArea(int top, int bottom);
+    void setScroll(int offset);
+    void scrollBy(int amount);
+    int getScroll() { return scroll_offset; }
+    int mapRows(int y, int h, scroll_run_t *runs);
+    void writeRect(int x, int y, int w, int h, uint16_t *pixels);
+
+    void startWrite() override;
+#ifndef DISPLAY_BACKEND_TFT_ESPI
+    void readRect(int x, int y, int w, int h, uint16_t *out);
+    int readScanline();
+#endif
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+    void writePixel(int16_t x, int16_t y, uint16_t color) override;
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+    void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+    void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+    void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+
+private:
+    int mapRow(int y);
+    int scroll_top = 0;
+    int scroll_height = 0;
+    int scroll_offset = 0;
+};
+
+#endif
@@ -0,0 +1,251 @@
+#include <Arduino.h>
+#include "sprite.h"
+#include "display.h"
+#include "strip.h"
+#include "render.h"
+#include "ball.h"
+
+// Circle sprites
+// Each radius is stored as one horizontal span per row, rasterised once with
+// the same midpoint algorithm Adafruit_GFX::fillCircle uses, so sprite draws
+// and GFX draws cover identical pixels. Moving the ball only writes the spans
+// that differ between the old and new position. Every slot of the ball pool
+// has its own sprite. Panel writes go through the
+// render queue as spans.
+// Sprites keep a save-under of the scenery they cover, composed from the
+// game state rather than read back from the panel, and put exactly those
+// pixels back when they move away. Scenery changes go through the dirty list,
+// whose repaints include the sprites, so a stale save-under never shows.
+
+// Half width of each row, indexed [radius][dy + radius]
+static int8_t span_half[SPRITE_MAX_RADIUS + 1][2 * SPRITE_MAX_RADIUS + 1];
+
+// One sprite and double-buffered save-under per ball pool slot
+static ball_sprite_t ball_sprites[BALL_POOL_SIZE];
+static uint16_t ball_under_pixels[BALL_POOL_SIZE][2][BALL_UNDER_SIZE * BALL_UNDER_SIZE];
+static save_under_t ball_under[BALL_POOL_SIZE][2];
+static uint8_t ball_under_cur[BALL_POOL_SIZE]; // Save-under of the drawn ball
+
+ball_sprite_t *get_ball_sprite(int slot) {
+    return &ball_sprites[slot];
+}
+
+// --- SAVE-UNDER ---
+void save_under_attach(save_under_t *s, uint16_t *pixels, int capacity) {
+    s->pixels = pixels;
+    s->capacity = capacity;
+    s->valid = false;
+}
+
+// Compose the scenery inside a rectangle, clipped to the screen
+void save_under_capture(save_under_t *s, int x, int y, int w, int h) {
+    static StripCanvas canvas;
+
+    int x0 = max(x, 0);
+    int y0 = max(y, 0);
+    int x1 = min(x + w, SCREEN_WIDTH);
+    int y1 = min(y + h, SCREEN_HEIGHT);
+    s->valid = false;
+    if (x1 <= x0 || y1 <= y0 || (x1 - x0) * (y1 - y0) > s->capacity)
+        return;
+
+    s->x = x0;
+    s->y = y0;
+    s->w = x1 - x0;
+    s->h = y1 - y0;
+
+    canvas.attach(s->pixels);
+    canvas.setBand(s->x, s->y, s->w, s->h);
+    canvas.fillScreen(~ST77XX_BLACK);
+    compose_background(canvas, s->x, s->y, s->w, s->h);
+    s->valid = true;
+}
+
+// Put back the saved pixels of columns [x0, x1] on row sy, one fill per run of equal colour
+void save_under_restore_span(const save_under_t *s, int sy, int x0, int x1) {
+    if (!s->valid || sy < s->y || sy >= s->y + s->h) {
+        render_hspan(x0, sy, x1 - x0 + 1, ~ST77XX_BLACK);
+        return;
+    }
+
+    x0 = max(x0, s->x);
+    x1 = min(x1, s->x + s->w - 1);
+    const uint16_t *row = &s->pixels[(sy - s->y) * s->w];
+    int run = x0;
+    for (int x = x0 + 1; x <= x1 + 1; x++) {
+        if (x > x1 || row[x - s->x] != row[run - s->x]) {
+            render_hspan(run, sy, x - run, row[run - s->x]);
+            run = x;
+        }
+    }
+}
+
+void save_under_restore(const save_under_t *s, int x, int y, int w, int h) {
+    for (int sy = y; sy < y + h; sy++)
+        save_under_restore_span(s, sy, x, x + w - 1);
+}
+
+// Widen the row spans covered by a vertical line at column dx
+static void mark_column(int radius, int dx, int top, int len) {
+    for (int dy = top; dy < top + len; dy++) {
+        int8_t *half = &span_half[radius][dy + radius];
+        if (abs(dx) > *half)
+            *half = abs(dx);
+    }
+}
+
+// Same stepping as Adafruit_GFX::fillCircleHelper, relative to the centre
+static void build_mask(int radius) {
+    for (int i = 0; i < 2 * SPRITE_MAX_RADIUS + 1; i++)
+        span_half[radius][i] = 0;
+
+    int f = 1 - radius;
+    int ddF_x = 1;
+    int ddF_y = -2 * radius;
+    int x = 0;
+    int y = radius;
+    int px = x;
+    int py = y;
+
+    while (x < y) {
+        if (f >= 0) {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+        if (x < (y + 1))
+            mark_column(radius, x, -y, 2 * y + 1);
+        if (y != py) {
+            mark_column(radius, py, -px, 2 * px + 1);
+            py = y;
+        }
+        px = x;
+    }
+}
+
+void sprite_init() {
+    for (int r = 0; r <= SPRITE_MAX_RADIUS; r++)
+        build_mask(r);
+    for (int b = 0; b < BALL_POOL_SIZE; b++)
+        for (int i = 0; i < 2; i++)
+            save_under_attach(&ball_under[b][i], ball_under_pixels[b][i], BALL_UNDER_SIZE * BALL_UNDER_SIZE);
+}
+
+void sprite_fill_circle(Adafruit_GFX &g, int x, int y, int radius, uint16_t color) {
+    if (radius > SPRITE_MAX_RADIUS) {
+        g.fillCircle(x, y, radius, color);
+        return;
+    }
+    for (int dy = -radius; dy <= radius; dy++) {
+        int half = span_half[radius][dy + radius];
+        g.drawFastHLine(x - half, y + dy, 2 * half + 1, color);
+    }
+}
+
+// Queue every span of a circle sprite
+static void queue_circle(int x, int y, int radius, uint16_t color) {
+    for (int dy = -radius; dy <= radius; dy++) {
+        int half = span_half[radius][dy + radius];
+        render_hspan(x - half, y + dy, 2 * half + 1, color);
+    }
+}
+
+// Span of a sprite on screen row sy, false if the row misses it
+static bool row_span(int cx, int cy, int radius, int sy, int *x0, int *x1) {
+    int dy = sy - cy;
+    if (dy < -radius || dy > radius)
+        return false;
+    int half = span_half[radius][dy + radius];
+    *x0 = cx - half;
+    *x1 = cx + half;
+    return true;
+}
+
+// Write the parts of [a0, a1] not covered by [b0, b1]
+// With a save-under the parts are restored from it instead of filled with color
+static void write_difference(int sy, int a0, int a1, bool has_b, int b0, int b1, uint16_t color, const save_under_t *under) {
+    int spans[2][2];
+    int n = 0;
+
+    if (!has_b || b1 < a0 || b0 > a1) {
+        spans[n][0] = a0; spans[n++][1] = a1;
+    } else {
+        if (a0 < b0) { spans[n][0] = a0; spans[n++][1] = b0 - 1; }
+        if (a1 > b1) { spans[n][0] = b1 + 1; spans[n++][1] = a1; }
+    }
+
+    for (int i = 0; i < n; i++) {
+        if (under)
+            save_under_restore_span(under, sy, spans[i][0], spans[i][1]);
+        else
+            render_hspan(spans[i][0], sy, spans[i][1] - spans[i][0] + 1, color);
+    }
+}
+
+// Move a ball sprite, only writing pixels that change colour
+void sprite_move_ball(int slot, int x, int y, int radius, uint16_t color) {
+    ball_sprite_t &ball_sprite = ball_sprites[slot];
+    if (radius > SPRITE_MAX_RADIUS)
+        radius = SPRITE_MAX_RADIUS;
+
+    if (ball_sprite.drawn && ball_sprite.x == x && ball_sprite.y == y && ball_sprite.radius == radius)
+        return;
+
+    // Scenery under the new position, before the ball covers it
+    int next = ball_under_cur[slot] ^ 1;
+    save_under_capture(&ball_under[slot][next], x - radius, y - radius, 2 * radius + 1, 2 * radius + 1);
+
+    if (!ball_sprite.drawn) {
+        queue_circle(x, y, radius, color);
+    } else {
+        int ox = ball_sprite.x, oy = ball_sprite.y, orad = ball_sprite.radius;
+        int top = min(oy - orad, y - radius);
+        int bottom = max(oy + orad, y + radius);
+
+        for (int sy = top; sy <= bottom; sy++) {
+            int a0, a1, b0, b1;
+            bool has_old = row_span(ox, oy, orad, sy, &a0, &a1);
+            bool has_new = row_span(x, y, radius, sy, &b0, &b1);
+
+            if (has_old)
+                write_difference(sy, a0, a1, has_new, b0, b1, 0, &ball_under[slot][ball_under_cur[slot]]);
+            if (has_new)
+                write_difference(sy, b0, b1, has_old, a0, a1, color, NULL);
+        }
+    }
+
+    ball_under_cur[slot] = next;
+    ball_sprite.x = x;
+    ball_sprite.y = y;
+    ball_sprite.radius = radius;
+    ball_sprite.drawn = true;
+}
+
+// Remove a ball from the screen entirely, the next move draws it whole
+void sprite_erase_ball(int slot) {
+    ball_sprite_t &ball_sprite = ball_sprites[slot];
+    if (!ball_sprite.drawn)
+        return;
+
+    const save_under_t *under = &ball_under[slot][ball_under_cur[slot]];
+    int r = ball_sprite.radius;
+    for (int dy = -r; dy <= r; dy++) {
+        int half = span_half[r][dy + r];
+        save_under_restore_span(under, ball_sprite.y + dy, ball_sprite.x - half, ball_sprite.x + half);
+    }
+    ball_sprite.drawn = false;
+}
+
+void sprite_erase_balls() {
+    for (int slot = 0; slot < BALL_POOL_SIZE; slot++)
+        sprite_erase_ball(slot);
+}
+
+// Screen under every ball was cleared
+void sprite_invalidate_balls() {
+    for (int slot = 0; slot < BALL_POOL_SIZE; slot++)
+        ball_sprites[slot].drawn = false;
+}
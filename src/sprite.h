@@ -0,0 +1,38 @@
+#include "Adafruit_GFX.h"
+
+// Sprite constants
+#define SPRITE_MAX_RADIUS 4 // 3 for the ball, 4 for the large ball powerup
+#define BALL_UNDER_SIZE (2 * SPRITE_MAX_RADIUS + 1)
+
+#ifndef SPRITE_H
+#define SPRITE_H
+
+// Structs
+typedef struct {
+    int x, y;
+    int radius;
+    bool drawn;     // False once the screen under the ball was cleared
+} ball_sprite_t;
+
+// Scenery pixels under a sprite, restored exactly when it moves away
+typedef struct {
+    int x, y, w, h;
+    bool valid;
+    uint16_t *pixels;   // w * h, row major
+    int capacity;
+} save_under_t;
+
+// Function declarations
+ball_sprite_t *get_ball_sprite(int slot);
+void sprite_init();
+void sprite_fill_circle(Adafruit_GFX &g, int x, int y, int radius, uint16_t color);
+void save_under_attach(save_under_t *s, uint16_t *pixels, int capacity);
+void save_under_capture(save_under_t *s, int x, int y, int w, int h);
+void save_under_restore_span(const save_under_t *s, int sy, int x0, int x1);
+void save_under_restore(const save_under_t *s, int x, int y, int w, int h);
+void sprite_move_ball(int slot, int x, int y, int radius, uint16_t color);
+void sprite_erase_ball(int slot);
+void sprite_erase_balls();
+void sprite_invalidate_balls();
+
+#endif
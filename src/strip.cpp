@@ -0,0 +1,196 @@
+#include <Arduino.h>
+#include "scroll.h"
+#include "strip.h"
+#include "display.h"
+#include "render.h"
+#include "beam.h"
+#include "esp_log.h"
+
+// Strip renderer
+// Composes an area of the screen one horizontal band at a time into RAM and
+// hands each finished band to a flush task on the other core. While a band is
+// on the bus the caller is already composing the next one into the second
+// buffer, so drawing overlaps with SPI transfers instead of stalling on every
+// primitive. Scene regions are composed by the render task on core 0, so the
+// flush task lives on core 1.
+
+extern ScrollST7789 tft;
+
+// Two 240x16 RGB565 bands, 7.5KB each
+static uint16_t strip_buf[STRIP_BUFFERS][SCREEN_WIDTH * STRIP_HEIGHT];
+static StripCanvas strip_canvas[STRIP_BUFFERS];
+
+// Band handed to the flush task
+typedef struct {
+    uint16_t *buf;
+    int x, y, w, h;
+} strip_job_t;
+
+static volatile strip_job_t pending_job;
+static TaskHandle_t flush_task_handle = NULL;
+static SemaphoreHandle_t flush_idle = NULL;
+strip_stats_t strip_stats = { 0, 0, 0 };
+
+strip_stats_t *get_strip_stats() {
+    return &strip_stats;
+}
+
+bool strip_is_flush_task() {
+    return flush_task_handle != NULL && xTaskGetCurrentTaskHandle() == flush_task_handle;
+}
+
+// --- CANVAS ---
+StripCanvas::StripCanvas() : Adafruit_GFX(SCREEN_WIDTH, SCREEN_HEIGHT), buffer(NULL), band_x(0), band_y(0), band_w(0), band_h(0) {}
+
+void StripCanvas::attach(uint16_t *buf) {
+    buffer = buf;
+}
+
+void StripCanvas::setBand(int x, int y, int w, int h) {
+    band_x = x;
+    band_y = y;
+    band_w = w;
+    band_h = h;
+}
+
+void StripCanvas::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    x -= band_x;
+    y -= band_y;
+    if (x < 0 || y < 0 || x >= band_w || y >= band_h)
+        return;
+    buffer[y * band_w + x] = color;
+}
+
+void StripCanvas::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    int x0 = max((int)x - band_x, 0);
+    int y0 = max((int)y - band_y, 0);
+    int x1 = min((int)x + w - band_x, band_w);
+    int y1 = min((int)y + h - band_y, band_h);
+    if (x1 <= x0 || y1 <= y0)
+        return;
+
+    for (int row = y0; row < y1; row++) {
+        uint16_t *p = &buffer[row * band_w + x0];
+        for (int col = x0; col < x1; col++)
+            *p++ = color;
+    }
+}
+
+void StripCanvas::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    fillRect(x, y, w, 1, color);
+}
+
+void StripCanvas::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    fillRect(x, y, 1, h, color);
+}
+
+void StripCanvas::fillScreen(uint16_t color) {
+    fillRect(band_x, band_y, band_w, band_h, color);
+}
+
+// --- FLUSH ---
+// Pushes one band per notification, signals flush_idle when the bus is free
+static void strip_flush_task(void *pvParameters) {
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        beam_wait(pending_job.y, pending_job.y + pending_job.h, pending_job.w * pending_job.h);
+        tft.startWrite();
+        tft.writeRect(pending_job.x, pending_job.y, pending_job.w, pending_job.h, pending_job.buf);
+        tft.endWrite();
+
+        xSemaphoreGive(flush_idle);
+    }
+}
+
+static void wait_flush_idle() {
+    int64_t start = esp_timer_get_time();
+    xSemaphoreTake(flush_idle, portMAX_DELAY);
+    strip_stats.wait_us += esp_timer_get_time() - start;
+}
+
+static void submit_band(StripCanvas *canvas, int x, int y, int w, int h) {
+    wait_flush_idle();
+
+    pending_job.buf = canvas->getBuffer();
+    pending_job.x = x;
+    pending_job.y = y;
+    pending_job.w = w;
+    pending_job.h = h;
+
+    strip_stats.bands++;
+    strip_stats.pixels += w * h;
+
+    xTaskNotifyGive(flush_task_handle);
+}
+
+// Buffer the next band is composed into, carried across calls so a band still
+// on the bus from the previous area is never overwritten
+static int cur_buf = 0;
+
+// Compose and push an area of the screen, band by band
+// Returns with the last band possibly still on the bus, call strip_finish()
+// before anything else touches the panel. Lets the render task compose the
+// next queued region while this one finishes.
+void strip_render_async(int x, int y, int w, int h, strip_compose_fn compose, uint16_t background) {
+    // Clip to screen
+    int x0 = max(x, 0);
+    int y0 = max(y, 0);
+    int x1 = min(x + w, SCREEN_WIDTH);
+    int y1 = min(y + h, SCREEN_HEIGHT);
+    if (x1 <= x0 || y1 <= y0)
+        return;
+    w = x1 - x0;
+
+    // Bands must not overtake draws still in the render queue
+    render_sync();
+
+    for (int band_y = y0; band_y < y1; band_y += STRIP_HEIGHT) {
+        int band_h = min(STRIP_HEIGHT, y1 - band_y);
+        StripCanvas *canvas = &strip_canvas[cur_buf];
+
+        // With two buffers, this one was handed off two bands ago
+        // submit_band() already waited for it to finish
+        canvas->setBand(x0, band_y, w, band_h);
+        canvas->fillScreen(background);
+        compose(*canvas, x0, band_y, w, band_h);
+
+        submit_band(canvas, x0, band_y, w, band_h);
+        cur_buf = (cur_buf + 1) % STRIP_BUFFERS;
+    }
+}
+
+// Wait for the band on the bus, if any, so the caller may use tft again
+void strip_finish() {
+    if (flush_idle == NULL)
+        return;
+    wait_flush_idle();
+    xSemaphoreGive(flush_idle);
+}
+
+// Compose and push an area, returns once the last band is on the panel
+void strip_render(int x, int y, int w, int h, strip_compose_fn compose, uint16_t background) {
+    strip_render_async(x, y, w, h, compose, background);
+    strip_finish();
+}
+
+// --- INIT ---
+void strip_init() {
+    for (int i = 0; i < STRIP_BUFFERS; i++)
+        strip_canvas[i].attach(strip_buf[i]);
+
+    flush_idle = xSemaphoreCreateBinary();
+    xSemaphoreGive(flush_idle);
+
+    xTaskCreatePinnedToCore(
+        strip_flush_task,
+        "StripFlush",
+        2048,
+        NULL,
+        STRIP_TASK_PRIORITY,
+        &flush_task_handle,
+        STRIP_TASK_CORE
+    );
+
+    ESP_LOGI("DISPLAY", "STRIP RENDERER INIT (%d x %dpx BANDS)", STRIP_BUFFERS, STRIP_HEIGHT);
+}
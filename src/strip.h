@@ -0,0 +1,51 @@
+#include "Adafruit_GFX.h"
+
+// Strip renderer constants
+#define STRIP_HEIGHT 16
+#define STRIP_BUFFERS 2
+#define STRIP_TASK_CORE 1 // Opposite RENDER_TASK_CORE, where scene regions are composed
+#define STRIP_TASK_PRIORITY 2
+
+#ifndef STRIP_H
+#define STRIP_H
+
+// Draws the scene into a strip canvas, in screen coordinates
+// x, y, w, h is the area being composed, anything outside of it is clipped
+typedef void (*strip_compose_fn)(Adafruit_GFX &g, int x, int y, int w, int h);
+
+// GFX target backed by one strip buffer
+// Keeps the full screen as its logical size so text and shape clipping in
+// Adafruit_GFX behaves as on the panel, and only stores the current band
+class StripCanvas : public Adafruit_GFX {
+public:
+    StripCanvas();
+    void attach(uint16_t *buf);
+    void setBand(int x, int y, int w, int h);
+    uint16_t *getBuffer() { return buffer; }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+    void fillScreen(uint16_t color) override;
+
+private:
+    uint16_t *buffer;
+    int band_x, band_y, band_w, band_h;
+};
+
+typedef struct {
+    uint32_t bands;         // Bands pushed since boot
+    uint32_t pixels;        // Pixels pushed since boot
+    uint32_t wait_us;       // Time spent waiting on the flush task since boot
+} strip_stats_t;
+
+// Function declarations
+void strip_init();
+void strip_render(int x, int y, int w, int h, strip_compose_fn compose, uint16_t background);
+void strip_render_async(int x, int y, int w, int h, strip_compose_fn compose, uint16_t background);
+void strip_finish();
+strip_stats_t *get_strip_stats();
+bool strip_is_flush_task();
+
+#endif
@@ -0,0 +1,140 @@
+#include <Arduino.h>
+#include <cmath>
+#include "sweep.h"
+#include "fixed.h"
+
+// Swept circle collision
+// A circle of radius r moving by (mx, my) touches a rect exactly when its
+// centre enters the rect grown by r with rounded corners. The centre's path
+// is tested against the grown rect's faces (slabs), and against the corner
+// circle when it enters through a corner. Contacts with the circle moving
+// away from the surface are ignored, so a circle resting on a face after a
+// bounce can always leave it. All maths is in phys_t, so it runs in fixed
+// point with USE_FIXED_PHYSICS.
+
+// Earliest t >= 0 at which the point enters the circle (cx, cy, r)
+// Callers start the point next to the circle, which keeps every term small
+// enough for Q16.16
+static bool ray_circle(phys_t x, phys_t y, phys_t mx, phys_t my, phys_t cx, phys_t cy, phys_t r, phys_t *t) {
+    phys_t fx = x - cx, fy = y - cy;
+    phys_t a = mx * mx + my * my;
+    phys_t b = fx * mx + fy * my;
+    phys_t c = fx * fx + fy * fy - r * r;
+    if (a <= 0 || b >= 0)
+        return false; // Not moving, or moving away from the corner
+
+    phys_t disc = b * b - a * c;
+    if (disc < 0)
+        return false;
+
+    phys_t t0 = (-b - phys_sqrt(disc)) / a;
+    *t = max(t0, phys_t(0));
+    return true;
+}
+
+// Circle already touching the rect, push it out along the shallowest axis
+static bool overlap_normal(phys_t x, phys_t y, phys_t r, phys_t mx, phys_t my,
+                           phys_t left, phys_t top, phys_t right, phys_t bottom, sweep_hit_t *hit) {
+    phys_t qx = constrain(x, left, right);
+    phys_t qy = constrain(y, top, bottom);
+    phys_t dx = x - qx, dy = y - qy;
+    if (phys_abs(dx) >= r || phys_abs(dy) >= r)
+        return false; // Far apart, and squaring could overflow in fixed point
+    phys_t d2 = dx * dx + dy * dy;
+    if (d2 >= r * r)
+        return false;
+
+    if (d2 > 0) {
+        phys_t d = phys_sqrt(d2);
+        hit->nx = dx / d;
+        hit->ny = dy / d;
+    } else {
+        // Centre inside the rect
+        phys_t pen[4] = { x - left, right - x, y - top, bottom - y };
+        int side = 0;
+        for (int i = 1; i < 4; i++)
+            if (pen[i] < pen[side])
+                side = i;
+        hit->nx = side == 0 ? -1 : side == 1 ? 1 : 0;
+        hit->ny = side == 2 ? -1 : side == 3 ? 1 : 0;
+    }
+
+    hit->t = 0;
+    return mx * hit->nx + my * hit->ny < 0;
+}
+
+// One slab of the grown rect, narrows [t_enter, t_exit], remembers the entry axis
+static bool clip_slab(phys_t p, phys_t m, phys_t lo, phys_t hi, phys_t *t_enter, phys_t *t_exit, phys_t *n, int *axis_hit, int axis) {
+    if (m == 0)
+        return p >= lo && p <= hi;
+
+    phys_t t0 = (lo - p) / m;
+    phys_t t1 = (hi - p) / m;
+    phys_t face = -1;
+    if (t0 > t1) {
+        phys_t tmp = t0; t0 = t1; t1 = tmp;
+        face = 1;
+    }
+    if (t0 > *t_enter) {
+        *t_enter = t0;
+        *n = face;
+        *axis_hit = axis;
+    }
+    *t_exit = min(*t_exit, t1);
+    return *t_enter <= *t_exit;
+}
+
+bool sweep_circle_rect(phys_t x, phys_t y, phys_t r, phys_t mx, phys_t my,
+                       phys_t left, phys_t top, phys_t right, phys_t bottom, sweep_hit_t *hit) {
+    if (overlap_normal(x, y, r, mx, my, left, top, right, bottom, hit))
+        return true;
+
+    phys_t t_enter = PHYS_MIN, t_exit = PHYS_MAX, n = 0;
+    int axis = -1;
+    if (!clip_slab(x, mx, left - r, right + r, &t_enter, &t_exit, &n, &axis, 0) ||
+        !clip_slab(y, my, top - r, bottom + r, &t_enter, &t_exit, &n, &axis, 1))
+        return false;
+    if (t_enter > 1 || t_exit < 0 || axis < 0)
+        return false;
+
+    // Entered through (or starting in) a corner square, only the rounded corner is solid
+    phys_t te = max(t_enter, phys_t(0));
+    phys_t px = x + mx * te, py = y + my * te;
+    bool out_x = px < left || px > right;
+    bool out_y = py < top || py > bottom;
+    if (out_x && out_y) {
+        phys_t cx = px < left ? left : right;
+        phys_t cy = py < top ? top : bottom;
+        phys_t t;
+        if (!ray_circle(px, py, mx, my, cx, cy, r, &t) || te + t > 1)
+            return false;
+        hit->t = te + t;
+        hit->nx = (px + mx * t - cx) / r;
+        hit->ny = (py + my * t - cy) / r;
+        return true;
+    }
+
+    if (t_enter < 0)
+        return false; // Already in a face band means touching, overlap_normal had it
+
+    hit->t = t_enter;
+    hit->nx = axis == 0 ? n : phys_t(0);
+    hit->ny = axis == 1 ? n : phys_t(0);
+    return mx * hit->nx + my * hit->ny < 0;
+}
+
+// Circle against an axis-aligned wall at `wall`, solid on the side opposite dir
+// dir is +1 when the wall faces the +axis (left wall, ceiling), -1 otherwise
+// Only t is set, the caller knows the wall's normal
+bool sweep_circle_wall(phys_t pos, phys_t r, phys_t move, phys_t wall, int dir, sweep_hit_t *hit) {
+    if (move * dir >= 0)
+        return false; // Moving away from the wall
+
+    phys_t gap = (pos - dir * r - wall) * dir;
+    phys_t t = gap <= 0 ? phys_t(0) : gap / -(move * dir);
+    if (t > 1)
+        return false;
+
+    hit->t = t;
+    return true;
+}
@@ -0,0 +1,19 @@
+#include <Arduino.h>
+#include "fixed.h"
+
+#ifndef SWEEP_H
+#define SWEEP_H
+
+// First contact along a move, t is the fraction of the move travelled
+// (nx, ny) is the unit surface normal at the contact, pointing at the circle
+typedef struct {
+    phys_t t;
+    phys_t nx, ny;
+} sweep_hit_t;
+
+// Function declarations
+bool sweep_circle_rect(phys_t x, phys_t y, phys_t r, phys_t mx, phys_t my,
+                       phys_t left, phys_t top, phys_t right, phys_t bottom, sweep_hit_t *hit);
+bool sweep_circle_wall(phys_t pos, phys_t r, phys_t move, phys_t wall, int dir, sweep_hit_t *hit);
+
+#endif
@@ -1,7 +1,9 @@
 #include <Arduino.h>
 #include <Preferences.h>
+#include "profile.h"
 #include "system.h"
 #include "esp_system.h"
+#include "esp_ota_ops.h"
 #include "debug.h"
 #include "display.h"
 
@@ -144,6 +146,40 @@ void set_hiscore(int hiscore) {
     Serial.println("New high score saved");
 }
 
+// Identifies the running build, the first word of its ELF hash
+static uint32_t firmware_tag() {
+    uint32_t tag;
+    memcpy(&tag, esp_ota_get_app_description()->app_elf_sha256, sizeof(tag));
+    return tag;
+}
+
+// Panel SPI clock found by the boot probe, 0 if it never ran or a different build ran it
+uint32_t get_spi_clock() {
+    if (prefs.getUInt("spi_fw", 0) != firmware_tag())
+        return 0;
+    return prefs.getUInt("spi_hz", 0);
+}
+
+void set_spi_clock(uint32_t hz) {
+    prefs.putUInt("spi_hz", hz);
+    prefs.putUInt("spi_fw", firmware_tag());
+    Serial.println("SPI clock saved: " + String(hz));
+}
+
+void clear_spi_clock() {
+    prefs.remove("spi_hz");
+    prefs.remove("spi_fw");
+}
+
+// Performance profile picked in the pause menu
+int get_profile_setting() {
+    return prefs.getUChar("profile", DEFAULT_PROFILE);
+}
+
+void set_profile_setting(int profile) {
+    prefs.putUChar("profile", profile);
+}
+
 void system_init() {
     // Setup pins / serial
     Serial.begin(115200);
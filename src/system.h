@@ -31,6 +31,11 @@ extern float battery_volts;
 
 int get_hiscore();
 void set_hiscore(int hiscore);
+uint32_t get_spi_clock();
+void set_spi_clock(uint32_t hz);
+void clear_spi_clock();
+int get_profile_setting();
+void set_profile_setting(int profile);
 void battery_monitor_task(void *pvParameters);
 float readBatteryVoltage();
 void led_brightness(int level);
@@ -3,6 +3,5 @@
 
 int getRandomInt(int min, int max);
 float getRandomFloat(float min, float max);
-void delay_60_hz(float cur_f_time);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,106 @@
+#!/usr/bin/env python3
+"""Pack PNG screens and sprites into the flash asset bundle.
+
+Each PNG in the source directory (assets/ in this repo) becomes one image,
+named after the file (game_over.png -> "game_over", see asset_names in
+src/assets.cpp). Images are converted to RGB565, inverted like every other
+colour the panel is sent, and RLE compressed. The bundle goes to the "assets" partition in partitions.csv:
+
+    python tools/pack_assets.py assets assets.bin
+    esptool.py --chip esp32 write_flash 0x290000 assets.bin
+
+Full screen images must be 240x320. Needs Pillow.
+"""
+
+import argparse
+import pathlib
+import struct
+import sys
+
+from PIL import Image
+
+MAGIC = 0x31414B42  # "BKA1"
+VERSION = 1
+NAME_LEN = 16
+RUN_FLAG = 0x8000
+MAX_COUNT = 0x8000
+PARTITION_SIZE = 0x160000
+
+HEADER = struct.Struct("<IHHII")
+ENTRY = struct.Struct("<%dsHHII" % NAME_LEN)
+
+
+def to_panel565(r, g, b):
+    rgb = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+    return ~rgb & 0xFFFF
+
+
+def rle_encode(pixels):
+    """16-bit tokens: RUN_FLAG | (n - 1) + one pixel, or (n - 1) + n pixels."""
+    out = []
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:MAX_COUNT]
+            del literal[:MAX_COUNT]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+
+    i = 0
+    while i < len(pixels):
+        run = 1
+        while i + run < len(pixels) and run < MAX_COUNT and pixels[i + run] == pixels[i]:
+            run += 1
+
+        # A run of two costs the same as two literals, keep literals together
+        if run > 2:
+            flush_literal()
+            out.append(RUN_FLAG | (run - 1))
+            out.append(pixels[i])
+        else:
+            literal.extend(pixels[i:i + run])
+        i += run
+
+    flush_literal()
+    return struct.pack("<%dH" % len(out), *out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("source", type=pathlib.Path, help="directory of PNG files")
+    parser.add_argument("output", type=pathlib.Path, help="bundle to write")
+    args = parser.parse_args()
+
+    images = []
+    for path in sorted(args.source.glob("*.png")):
+        name = path.stem.encode("ascii")
+        if len(name) > NAME_LEN:
+            sys.exit("%s: name longer than %d characters" % (path.name, NAME_LEN))
+
+        img = Image.open(path).convert("RGB")
+        w, h = img.size
+        rgb = img.tobytes()
+        pixels = [to_panel565(rgb[i], rgb[i + 1], rgb[i + 2]) for i in range(0, len(rgb), 3)]
+        data = rle_encode(pixels)
+        images.append((name, w, h, data))
+        print("%-16s %3dx%-3d %7d -> %7d bytes" % (path.stem, w, h, w * h * 2, len(data)))
+
+    offset = HEADER.size + ENTRY.size * len(images)
+    table = b""
+    blobs = b""
+    for name, w, h, data in images:
+        table += ENTRY.pack(name, w, h, offset, len(data))
+        blobs += data
+        offset += len(data)
+
+    size = offset
+    if size > PARTITION_SIZE:
+        sys.exit("bundle is %d bytes, the partition holds %d" % (size, PARTITION_SIZE))
+
+    args.output.write_bytes(HEADER.pack(MAGIC, VERSION, len(images), size, 0) + table + blobs)
+    print("%d images, %d bytes" % (len(images), size))
+
+
+if __name__ == "__main__":
+    main()